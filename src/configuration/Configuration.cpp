@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include <boost/property_tree/json_parser.hpp>
 #include <boost/property_tree/ptree.hpp>
 
@@ -22,16 +24,101 @@ Configuration::Configuration(const std::string &configFilePath, int maxRows, int
 
     try
     {
-        // Parse server configuration
-        m_serverAddress = pt.get<std::string>("server-address");
-        m_serverJsonAttribute = pt.get<std::string>("url-json-conf-attribute");
-        m_serverJsonValue = pt.get<std::string>("url-json-conf-value");
-        m_serverGraphAttribute = pt.get<std::string>("url-default-graph-attribute");
-        m_serverGraphValue = pt.get<std::string>("url-default-graph-value");
-        m_serverQueryAttribute = pt.get<std::string>("url-query-attribute");
+        // Parse server configuration (not needed when triples are read from a dump)
+        m_dumpFile = pt.get<std::string>("dump-file", "");
+        auto serverField = [&pt, this](const std::string &field) {
+            return m_dumpFile.empty() ? pt.get<std::string>(field) : pt.get<std::string>(field, "");
+        };
+
+        m_serverAddress = serverField("server-address");
+        m_serverJsonAttribute = serverField("url-json-conf-attribute");
+        m_serverJsonValue = serverField("url-json-conf-value");
+        m_serverGraphAttribute = serverField("url-default-graph-attribute");
+        m_serverGraphValue = serverField("url-default-graph-value");
+        m_serverQueryAttribute = serverField("url-query-attribute");
         m_serverUsername = pt.get<std::string>("username", "");
         m_serverPassword = pt.get<std::string>("password", "");
         m_serverTimeout = pt.get<int>("timeout", 10000);
+        m_serverMaxRetries = pt.get<int>("max-retries", 3);
+        m_serverParallelPages = std::max(pt.get<int>("parallel-pages", 1), 1);
+        m_serverHttp2 = pt.get<bool>("http2", false);
+        m_serverCompression = pt.get<bool>("compression", true);
+        m_serverAdaptivePaging = pt.get<bool>("adaptive-paging", false);
+        m_serverMinRows = std::min(std::max(pt.get<int>("min-rows", 100), 1), m_serverMaxRows);
+        m_serverTargetLatency = std::max(pt.get<int>("target-latency", 2000), 1);
+        m_batchedEdges = pt.get<bool>("batched-edges", false);
+        m_scopedIngestion = pt.get<bool>("scoped-ingestion", false);
+        m_pipelineCapacity = std::max(pt.get<int>("pipeline-capacity", 65536), 0);
+        m_telemetryReport = pt.get<std::string>("telemetry-report", "");
+        m_recordDirectory = pt.get<std::string>("record-directory", "");
+
+        auto method = pt.get<std::string>("query-method", "GET");
+        if (method == "GET")
+        {
+            m_serverQueryMethod = GET;
+        }
+        else if (method == "POST")
+        {
+            m_serverQueryMethod = POST;
+        }
+        else
+        {
+            logger.critical("Unknown query method: " + method);
+            std::exit(-1);
+        }
+
+        auto format = pt.get<std::string>("result-format", "JSON");
+        if (format == "JSON")
+        {
+            m_serverResultFormat = JSON_RESULTS;
+        }
+        else if (format == "TSV")
+        {
+            m_serverResultFormat = TSV_RESULTS;
+        }
+        else if (format == "CSV")
+        {
+            m_serverResultFormat = CSV_RESULTS;
+        }
+        else
+        {
+            logger.critical("Unknown result format: " + format);
+            std::exit(-1);
+        }
+
+        auto pagination = pt.get<std::string>("pagination", "Offset");
+        if (pagination == "Offset")
+        {
+            m_serverPagination = OFFSET;
+        }
+        else if (pagination == "Ordered")
+        {
+            m_serverPagination = ORDERED;
+        }
+        else if (pagination == "Keyset")
+        {
+            m_serverPagination = KEYSET;
+        }
+        else
+        {
+            logger.critical("Unknown pagination: " + pagination);
+            std::exit(-1);
+        }
+
+        auto discovery = pt.get<std::string>("predicate-discovery", "Scan");
+        if (discovery == "Scan")
+        {
+            m_predicateDiscovery = SCAN_DISCOVERY;
+        }
+        else if (discovery == "Targeted")
+        {
+            m_predicateDiscovery = TARGETED_DISCOVERY;
+        }
+        else
+        {
+            logger.critical("Unknown predicate discovery: " + discovery);
+            std::exit(-1);
+        }
 
         // Relation types
         for (boost::property_tree::ptree::value_type &t : pt.get_child("relation-types"))
@@ -80,9 +167,47 @@ std::string Configuration::toString() const
     configurationString += "Comparable non-empty dimension limit: " + std::to_string(m_comparableDimensionLimit) + "\n";
     configurationString += "Similarity mean between non-empty dimension limit: " + std::to_string(m_similarityLimit) + "\n";
 
+    if (!m_dumpFile.empty())
+        configurationString += "Dump file: " + m_dumpFile + "\n";
+
     configurationString += "Server address: " + m_serverAddress + "\n";
     configurationString += "timeout = " + std::to_string(m_serverTimeout) + "\n";
     configurationString += "max_rows = " + std::to_string(m_serverMaxRows) + "\n";
+    configurationString += "max_retries = " + std::to_string(m_serverMaxRetries) + "\n";
+    configurationString += "parallel_pages = " + std::to_string(m_serverParallelPages) + "\n";
+    configurationString += "Query method: " + std::string((m_serverQueryMethod == GET) ? "GET" : "POST") + "\n";
+    configurationString += "HTTP/2: " + std::string(m_serverHttp2 ? "enabled" : "disabled") + "\n";
+    configurationString += "Compression: " + std::string(m_serverCompression ? "enabled" : "disabled") + "\n";
+    configurationString += "Adaptive paging: " + std::string(m_serverAdaptivePaging ? "enabled" : "disabled") + "\n";
+    if (m_serverAdaptivePaging)
+    {
+        configurationString += "min_rows = " + std::to_string(m_serverMinRows) + "\n";
+        configurationString += "target_latency = " + std::to_string(m_serverTargetLatency) + "\n";
+    }
+
+    if (m_serverResultFormat == JSON_RESULTS)
+        configurationString += "Result format: JSON\n";
+    else if (m_serverResultFormat == TSV_RESULTS)
+        configurationString += "Result format: TSV\n";
+    else
+        configurationString += "Result format: CSV\n";
+
+    configurationString += "Batched edges: " + std::string(m_batchedEdges ? "enabled" : "disabled") + "\n";
+    configurationString += "Scoped ingestion: " + std::string(m_scopedIngestion ? "enabled" : "disabled") + "\n";
+    configurationString += "pipeline_capacity = " + std::to_string(m_pipelineCapacity) + "\n";
+    if (!m_telemetryReport.empty())
+        configurationString += "Telemetry report: " + m_telemetryReport + "\n";
+    if (!m_recordDirectory.empty())
+        configurationString += "Record directory: " + m_recordDirectory + "\n";
+    configurationString += "Predicate discovery: " + std::string((m_predicateDiscovery == SCAN_DISCOVERY) ? "scan" : "targeted") + "\n";
+
+    if (m_serverPagination == OFFSET)
+        configurationString += "Pagination: offset\n";
+    else if (m_serverPagination == ORDERED)
+        configurationString += "Pagination: ordered\n";
+    else
+        configurationString += "Pagination: keyset\n";
+
     configurationString += m_serverJsonAttribute + " = " + m_serverJsonValue + "\n";
     configurationString += m_serverGraphAttribute + " = " + m_serverGraphValue + "\n";
     configurationString += "Query attribute: " + m_serverQueryAttribute + "\n";
@@ -148,6 +273,11 @@ double Configuration::getSimilarityLimit() const
     return m_similarityLimit;
 }
 
+std::string Configuration::getDumpFile() const
+{
+    return m_dumpFile;
+}
+
 bool Configuration::hasServerAuthentication() const
 {
     return !m_serverUsername.empty() && !m_serverUsername.empty();
@@ -203,6 +333,86 @@ int Configuration::getServerMaxRows() const
     return m_serverMaxRows;
 }
 
+PaginationMode Configuration::getServerPagination() const
+{
+    return m_serverPagination;
+}
+
+int Configuration::getServerMaxRetries() const
+{
+    return m_serverMaxRetries;
+}
+
+int Configuration::getServerParallelPages() const
+{
+    return m_serverParallelPages;
+}
+
+QueryMethod Configuration::getServerQueryMethod() const
+{
+    return m_serverQueryMethod;
+}
+
+bool Configuration::isServerHttp2() const
+{
+    return m_serverHttp2;
+}
+
+bool Configuration::isServerCompression() const
+{
+    return m_serverCompression;
+}
+
+bool Configuration::isServerAdaptivePaging() const
+{
+    return m_serverAdaptivePaging;
+}
+
+int Configuration::getServerMinRows() const
+{
+    return m_serverMinRows;
+}
+
+int Configuration::getServerTargetLatency() const
+{
+    return m_serverTargetLatency;
+}
+
+ResultFormat Configuration::getServerResultFormat() const
+{
+    return m_serverResultFormat;
+}
+
+bool Configuration::isBatchedEdges() const
+{
+    return m_batchedEdges;
+}
+
+bool Configuration::isScopedIngestion() const
+{
+    return m_scopedIngestion;
+}
+
+PredicateDiscovery Configuration::getPredicateDiscovery() const
+{
+    return m_predicateDiscovery;
+}
+
+int Configuration::getPipelineCapacity() const
+{
+    return m_pipelineCapacity;
+}
+
+std::string Configuration::getTelemetryReport() const
+{
+    return m_telemetryReport;
+}
+
+std::string Configuration::getRecordDirectory() const
+{
+    return m_recordDirectory;
+}
+
 std::set<std::string> Configuration::getRelationTypes() const
 {
     return m_relationTypes;
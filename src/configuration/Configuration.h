@@ -12,6 +12,28 @@
 #include "DimensionConfiguration.h"
 #include "../io/Logger.h"
 
+enum QueryMethod {
+    GET,
+    POST
+};
+
+enum ResultFormat {
+    JSON_RESULTS,
+    TSV_RESULTS,
+    CSV_RESULTS
+};
+
+enum PaginationMode {
+    OFFSET,
+    ORDERED,
+    KEYSET
+};
+
+enum PredicateDiscovery {
+    SCAN_DISCOVERY,
+    TARGETED_DISCOVERY
+};
+
 class Configuration
 {
     public:
@@ -28,6 +50,7 @@ class Configuration
 
         std::string toString() const;
 
+        std::string getDumpFile() const;
         bool hasServerAuthentication() const;
         std::string getServerAddress() const;
         std::string getServerJsonAttribute() const;
@@ -39,6 +62,22 @@ class Configuration
         std::string getServerPassword() const;
         int getServerTimeout() const;
         int getServerMaxRows() const;
+        PaginationMode getServerPagination() const;
+        int getServerMaxRetries() const;
+        int getServerParallelPages() const;
+        QueryMethod getServerQueryMethod() const;
+        bool isServerHttp2() const;
+        bool isServerCompression() const;
+        bool isServerAdaptivePaging() const;
+        int getServerMinRows() const;
+        int getServerTargetLatency() const;
+        ResultFormat getServerResultFormat() const;
+        bool isBatchedEdges() const;
+        bool isScopedIngestion() const;
+        PredicateDiscovery getPredicateDiscovery() const;
+        int getPipelineCapacity() const;
+        std::string getTelemetryReport() const;
+        std::string getRecordDirectory() const;
 
         std::set<std::string> getRelationTypes() const;
 
@@ -60,6 +99,9 @@ class Configuration
         int m_comparableDimensionLimit;
         double m_similarityLimit;
 
+        // Local dump replacing the server
+        std::string m_dumpFile;
+
         // Server configuration
         std::string m_serverAddress;
         std::string m_serverJsonAttribute;
@@ -71,6 +113,22 @@ class Configuration
         std::string m_serverPassword;
         int m_serverTimeout;
         int m_serverMaxRows;
+        PaginationMode m_serverPagination;
+        int m_serverMaxRetries;
+        int m_serverParallelPages;
+        QueryMethod m_serverQueryMethod;
+        bool m_serverHttp2;
+        bool m_serverCompression;
+        bool m_serverAdaptivePaging;
+        int m_serverMinRows;
+        int m_serverTargetLatency;
+        ResultFormat m_serverResultFormat;
+        bool m_batchedEdges;
+        bool m_scopedIngestion;
+        PredicateDiscovery m_predicateDiscovery;
+        int m_pipelineCapacity;
+        std::string m_telemetryReport;
+        std::string m_recordDirectory;
 
         // Relation types
         std::set<std::string> m_relationTypes;
@@ -1,20 +1,24 @@
+#include <cstring>
+
 #include "CacheManager.h"
 
 
-CacheManager::CacheManager() : m_cache(), m_inverseCache()
+CacheManager::CacheManager() : m_cache(), m_inverseCache(), m_blocks(), m_block(nullptr), m_blockUsed(0)
 {
 
 }
 
-unsigned int CacheManager::getElementIndex(const std::string& element)
+unsigned int CacheManager::getElementIndex(std::string_view element)
 {
-    if (m_cache.find(element) == m_cache.end())
+    auto it = m_cache.find(element);
+    if (it == m_cache.end())
     {
-        m_cache[element] = m_inverseCache.size();
-        m_inverseCache.push_back(element);
+        std::string_view stored = store(element);
+        it = m_cache.emplace(stored, m_inverseCache.size()).first;
+        m_inverseCache.push_back(stored);
     }
 
-    return m_cache[element];
+    return it->second;
 }
 
 std::string CacheManager::getElementFromIndex(unsigned int index) const
@@ -22,5 +26,56 @@ std::string CacheManager::getElementFromIndex(unsigned int index) const
     if (index >= m_inverseCache.size())
         return "";
 
+    return std::string(m_inverseCache[index]);
+}
+
+std::string_view CacheManager::getElementView(unsigned int index) const
+{
+    if (index >= m_inverseCache.size())
+        return std::string_view();
+
     return m_inverseCache[index];
 }
+
+bool CacheManager::findElementIndex(std::string_view element, unsigned int &index) const
+{
+    auto it = m_cache.find(element);
+    if (it == m_cache.end())
+        return false;
+
+    index = it->second;
+    return true;
+}
+
+unsigned int CacheManager::size() const
+{
+    return static_cast<unsigned int>(m_inverseCache.size());
+}
+
+std::string_view CacheManager::store(std::string_view element)
+{
+    char *begin(nullptr);
+
+    // Strings larger than a block get their own block, the current block stays in use
+    if (element.size() > ARENA_BLOCK_SIZE)
+    {
+        m_blocks.emplace_back(new char[element.size()]);
+        begin = m_blocks.back().get();
+    }
+
+    else
+    {
+        if (!m_block || element.size() > ARENA_BLOCK_SIZE - m_blockUsed)
+        {
+            m_blocks.emplace_back(new char[ARENA_BLOCK_SIZE]);
+            m_block = m_blocks.back().get();
+            m_blockUsed = 0;
+        }
+
+        begin = m_block + m_blockUsed;
+        m_blockUsed += element.size();
+    }
+
+    std::memcpy(begin, element.data(), element.size());
+    return std::string_view(begin, element.size());
+}
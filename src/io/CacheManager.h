@@ -2,20 +2,40 @@
 #define TCN3R_CACHEMANAGER_H
 
 
-#include <map>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
+// Bytes of the blocks of the strings arena
+#define ARENA_BLOCK_SIZE 65536
+
+// Interning of strings: each distinct string is stored once, in blocks of an arena that are never moved, and gets
+// a dense index. Not thread-safe: strings can be read concurrently but not added
 class CacheManager
 {
     public:
         CacheManager();
-        unsigned int getElementIndex(const std::string& element);
+        CacheManager(const CacheManager&) = delete;
+        CacheManager& operator=(const CacheManager&) = delete;
+        CacheManager(CacheManager&&) = default;
+        CacheManager& operator=(CacheManager&&) = default;
+        unsigned int getElementIndex(std::string_view element);
         std::string getElementFromIndex(unsigned int index) const;
+        std::string_view getElementView(unsigned int index) const;
+        bool findElementIndex(std::string_view element, unsigned int &index) const;
+        unsigned int size() const;
 
     private:
-        std::map<std::string, unsigned int> m_cache;
-        std::vector<std::string> m_inverseCache;
+        std::string_view store(std::string_view element);
+
+        std::unordered_map<std::string_view, unsigned int> m_cache;
+        std::vector<std::string_view> m_inverseCache;
+
+        std::vector<std::unique_ptr<char[]>> m_blocks;
+        char *m_block;
+        unsigned long m_blockUsed;
 };
 
 
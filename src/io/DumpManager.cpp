@@ -0,0 +1,594 @@
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <tuple>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "DumpManager.h"
+#include "QueryFailed.h"
+
+#define UNBOUND std::numeric_limits<unsigned int>::max()
+
+
+DumpManager::DumpManager(Configuration const &parameters, Logger const &logger) : m_parameters(parameters),
+                                                                                 m_logger(logger), m_terms(),
+                                                                                 m_triplesBySubject(),
+                                                                                 m_triplesByObject()
+{
+    const std::string &path = m_parameters.getDumpFile();
+
+    int file = open(path.c_str(), O_RDONLY);
+    struct stat fileStatus{};
+    if (file < 0 || fstat(file, &fileStatus) != 0)
+    {
+        logger.critical("Not possible to open dump file: " + path);
+        std::exit(-1);
+    }
+
+    auto size = static_cast<size_t>(fileStatus.st_size);
+    logger.info("Load dump " + path + " (" + std::to_string(size) + " bytes)");
+
+    if (size > 0)
+    {
+        void *data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+        if (data == MAP_FAILED)
+        {
+            logger.critical("Not possible to map dump file: " + path);
+            std::exit(-1);
+        }
+
+        madvise(data, size, MADV_SEQUENTIAL);
+
+        const char *begin = static_cast<const char*>(data);
+        std::string extension = path.substr(path.rfind('.') + 1);
+        if (extension == "nt" || extension == "ntriples")
+            loadNTriples(begin, begin + size);
+        else
+            loadTurtle(begin, begin + size);
+
+        munmap(data, size);
+    }
+
+    close(file);
+
+    // Index triples, the dump is a set of triples
+    logger.info("Index triples");
+    std::sort(m_triplesBySubject.begin(), m_triplesBySubject.end(), [](const Triple &t1, const Triple &t2) {
+        return std::tie(t1.predicate, t1.subject, t1.object) < std::tie(t2.predicate, t2.subject, t2.object);
+    });
+
+    m_triplesBySubject.erase(std::unique(m_triplesBySubject.begin(), m_triplesBySubject.end(), [](const Triple &t1, const Triple &t2) {
+        return t1.predicate == t2.predicate && t1.subject == t2.subject && t1.object == t2.object;
+    }), m_triplesBySubject.end());
+
+    m_triplesByObject = m_triplesBySubject;
+    std::sort(m_triplesByObject.begin(), m_triplesByObject.end(), [](const Triple &t1, const Triple &t2) {
+        return std::tie(t1.predicate, t1.object, t1.subject) < std::tie(t2.predicate, t2.object, t2.subject);
+    });
+
+    logger.info(std::to_string(m_triplesBySubject.size()) + " triples, " + std::to_string(m_terms.size()) + " terms");
+}
+
+DumpManager::~DumpManager()
+= default;
+
+std::set<std::string> DumpManager::queryElements(const std::string &whereClause) const
+{
+    std::set<std::string> elements;
+    queryRows({"e"}, whereClause, [&elements](const std::vector<std::string> &row) {
+        elements.insert(row[0]);
+    });
+
+    return elements;
+}
+
+std::set<std::pair<std::string, std::string>> DumpManager::queryTwoElements(const std::string &whereClause) const
+{
+    std::set<std::pair<std::string, std::string>> elements;
+    queryRows({"e1", "e2"}, whereClause, [&elements](const std::vector<std::string> &row) {
+        elements.insert(std::pair<std::string, std::string>(row[0], row[1]));
+    });
+
+    return elements;
+}
+
+void DumpManager::queryRows(const std::vector<std::string> &variables, const std::string &whereClause,
+                            const RowHandler &rowHandler) const
+{
+    QueryPatterns patterns = parseWhereClause(whereClause);
+
+    std::vector<unsigned int> projection;
+    for (const auto &v : variables)
+    {
+        auto it = std::find(patterns.variables.begin(), patterns.variables.end(), v);
+        if (it == patterns.variables.end())
+        {
+            std::string message("Variable ?" + v + " not in query: " + whereClause);
+            m_logger.critical(message);
+            throw QueryFailed(message);
+        }
+
+        projection.push_back(static_cast<unsigned int>(it - patterns.variables.begin()));
+    }
+
+    if (patterns.unsatisfiable)
+    {
+        return;
+    }
+
+    // Distinct rows, as with SELECT DISTINCT
+    std::set<std::vector<unsigned int>> rows;
+    std::vector<unsigned int> row(projection.size());
+
+    std::vector<bool> matched(patterns.values.size() + patterns.triples.size(), false);
+    std::vector<unsigned int> bindings(patterns.variables.size(), UNBOUND);
+    matchPatterns(patterns, matched, bindings, [&rows, &row, &projection](const std::vector<unsigned int> &b) {
+        for (unsigned long i = 0; i < projection.size(); i++)
+        {
+            row[i] = b[projection[i]];
+        }
+
+        rows.insert(row);
+    });
+
+    std::vector<std::string> values(projection.size());
+    for (const auto &r : rows)
+    {
+        for (unsigned long i = 0; i < r.size(); i++)
+        {
+            values[i] = getValue(r[i]);
+        }
+
+        rowHandler(values);
+    }
+}
+
+void DumpManager::loadNTriples(const char *begin, const char *end)
+{
+    // Chunks end at line breaks: each one is parsed by a thread with its own terms, merged afterwards
+    auto chunksCount = static_cast<unsigned long>(m_parameters.getThreadsNumber()) * 4;
+    std::vector<const char*> bounds(chunksCount + 1, end);
+    bounds[0] = begin;
+
+    for (unsigned long c = 1; c < chunksCount; c++)
+    {
+        const char *bound = std::max(begin + (end - begin) * c / chunksCount, bounds[c - 1]);
+        auto newLine = static_cast<const char*>(std::memchr(bound, '\n', end - bound));
+        bounds[c] = (newLine != nullptr) ? newLine + 1 : end;
+    }
+
+    std::vector<CacheManager> chunksTerms(chunksCount);
+    std::vector<std::vector<Triple>> chunksTriples(chunksCount);
+    std::vector<std::string> errors(chunksCount);
+    std::vector<const char*> errorPositions(chunksCount, nullptr);
+
+    #pragma omp parallel for default(shared) num_threads(m_parameters.getThreadsNumber()) schedule(dynamic)
+    for (unsigned long c = 0; c < chunksCount; c++)
+    {
+        TurtleParser parser(bounds[c], bounds[c + 1], chunksTerms[c], chunksTriples[c]);
+        if (!parser.parse())
+        {
+            errors[c] = parser.getError();
+            errorPositions[c] = parser.getPosition();
+        }
+    }
+
+    for (unsigned long c = 0; c < chunksCount; c++)
+    {
+        if (errorPositions[c] != nullptr)
+        {
+            parsingError(begin, errorPositions[c], errors[c]);
+        }
+
+        std::vector<unsigned int> termsIndex(chunksTerms[c].size());
+        for (unsigned int t = 0; t < chunksTerms[c].size(); t++)
+        {
+            termsIndex[t] = m_terms.getElementIndex(chunksTerms[c].getElementFromIndex(t));
+        }
+
+        for (const auto &t : chunksTriples[c])
+        {
+            m_triplesBySubject.push_back({termsIndex[t.subject], termsIndex[t.predicate], termsIndex[t.object]});
+        }
+
+        std::vector<Triple>().swap(chunksTriples[c]);
+    }
+}
+
+void DumpManager::loadTurtle(const char *begin, const char *end)
+{
+    // Prefixes and multi-line statements prevent splitting Turtle documents: they are parsed sequentially
+    TurtleParser parser(begin, end, m_terms, m_triplesBySubject);
+    if (!parser.parse())
+    {
+        parsingError(begin, parser.getPosition(), parser.getError());
+    }
+}
+
+void DumpManager::parsingError(const char *begin, const char *position, const std::string &error) const
+{
+    long line = std::count(begin, position, '\n') + 1;
+    m_logger.critical("Error while parsing dump (line " + std::to_string(line) + "): " + error);
+    std::exit(-1);
+}
+
+QueryPatterns DumpManager::parseWhereClause(const std::string &whereClause) const
+{
+    // Tokens: punctuation, IRIs, literals, variables and names
+    std::vector<std::string> tokens;
+    unsigned long i(0);
+    while (i < whereClause.size())
+    {
+        char c = whereClause[i];
+        unsigned long start(i);
+
+        if (std::isspace(static_cast<unsigned char>(c)))
+        {
+            i++;
+            continue;
+        }
+
+        if (c == '{' || c == '}' || c == '.')
+        {
+            i++;
+        }
+
+        else if (c == '<')
+        {
+            i = whereClause.find('>', i);
+            i = (i == std::string::npos) ? whereClause.size() : i + 1;
+        }
+
+        else if (c == '"')
+        {
+            for (i++; i < whereClause.size() && whereClause[i] != '"'; i++)
+            {
+                if (whereClause[i] == '\\')
+                {
+                    i++;
+                }
+            }
+
+            i++;
+        }
+
+        else if (c == '[')
+        {
+            i = whereClause.find(']', i);
+            i = (i == std::string::npos) ? whereClause.size() : i + 1;
+            tokens.emplace_back("[]");
+            continue;
+        }
+
+        else
+        {
+            while (i < whereClause.size() && !std::isspace(static_cast<unsigned char>(whereClause[i]))
+                   && std::strchr("{}<\"", whereClause[i]) == nullptr)
+            {
+                i++;
+            }
+
+            // A final '.' ends the triple pattern
+            while (i > start + 1 && whereClause[i - 1] == '.')
+            {
+                i--;
+            }
+        }
+
+        tokens.push_back(whereClause.substr(start, i - start));
+    }
+
+    QueryPatterns patterns;
+    std::vector<std::pair<bool, unsigned int>> current;
+    unsigned long anonymousCount(0);
+
+    for (unsigned long t = 0; t < tokens.size(); t++)
+    {
+        const std::string &token = tokens[t];
+
+        if (token == "." || token == "{" || token == "}")
+        {
+            continue;
+        }
+
+        if (token == "VALUES" || token == "values")
+        {
+            // VALUES ?v { term ... }
+            if (t + 2 >= tokens.size() || (tokens[t + 1][0] != '?' && tokens[t + 1][0] != '$') || tokens[t + 2] != "{")
+            {
+                std::string message("Unsupported query on dump: " + whereClause);
+                m_logger.critical(message);
+                throw QueryFailed(message);
+            }
+
+            patterns.values.emplace_back(getVariable(patterns, tokens[t + 1].substr(1)), std::vector<unsigned int>());
+            for (t += 3; t < tokens.size() && tokens[t] != "}"; t++)
+            {
+                unsigned int term;
+                if (findTerm(tokens[t], whereClause, term))
+                {
+                    patterns.values.back().second.push_back(term);
+                }
+            }
+
+            if (patterns.values.back().second.empty())
+            {
+                patterns.unsatisfiable = true;
+            }
+
+            continue;
+        }
+
+        if (token[0] == '?' || token[0] == '$')
+        {
+            current.emplace_back(true, getVariable(patterns, token.substr(1)));
+        }
+
+        else if (token == "[]")
+        {
+            anonymousCount++;
+            current.emplace_back(true, getVariable(patterns, "[]" + std::to_string(anonymousCount)));
+        }
+
+        else
+        {
+            unsigned int term(0);
+            if (!findTerm(token, whereClause, term))
+            {
+                patterns.unsatisfiable = true;
+            }
+
+            current.emplace_back(false, term);
+        }
+
+        if (current.size() == 3)
+        {
+            TriplePattern pattern{};
+            for (unsigned long k = 0; k < 3; k++)
+            {
+                pattern.variable[k] = current[k].first;
+                pattern.value[k] = current[k].second;
+            }
+
+            patterns.triples.push_back(pattern);
+            current.clear();
+        }
+    }
+
+    if (!current.empty())
+    {
+        std::string message("Unsupported query on dump: " + whereClause);
+        m_logger.critical(message);
+        throw QueryFailed(message);
+    }
+
+    return patterns;
+}
+
+bool DumpManager::findTerm(const std::string &token, const std::string &whereClause, unsigned int &term) const
+{
+    static const std::map<std::string, std::string> prefixes = {
+            {"rdf", "http://www.w3.org/1999/02/22-rdf-syntax-ns#"},
+            {"rdfs", "http://www.w3.org/2000/01/rdf-schema#"},
+            {"owl", "http://www.w3.org/2002/07/owl#"},
+            {"xsd", "http://www.w3.org/2001/XMLSchema#"},
+            {"skos", "http://www.w3.org/2004/02/skos/core#"}
+    };
+
+    std::string key;
+
+    if (token == "a")
+    {
+        key = "Ihttp://www.w3.org/1999/02/22-rdf-syntax-ns#type";
+    }
+
+    else if (token[0] == '<')
+    {
+        key = "I" + token.substr(1, token.size() - 2);
+    }
+
+    else if (token[0] == '"')
+    {
+        key = "L";
+        for (unsigned long k = 1; k + 1 < token.size(); k++)
+        {
+            if (token[k] == '\\')
+            {
+                k++;
+            }
+
+            key += token[k];
+        }
+    }
+
+    else if (token.find(':') != std::string::npos)
+    {
+        auto prefix = prefixes.find(token.substr(0, token.find(':')));
+        if (prefix == prefixes.end())
+        {
+            std::string message("Unsupported prefix in query on dump: " + token);
+            m_logger.critical(message);
+            throw QueryFailed(message);
+        }
+
+        key = "I" + prefix->second + token.substr(token.find(':') + 1);
+    }
+
+    else if (std::isdigit(static_cast<unsigned char>(token[0])) || token == "true" || token == "false")
+    {
+        key = "L" + token;
+    }
+
+    else
+    {
+        std::string message("Unsupported query on dump: " + whereClause);
+        m_logger.critical(message);
+        throw QueryFailed(message);
+    }
+
+    // Terms absent from the dump cannot match
+    return m_terms.findElementIndex(key, term);
+}
+
+unsigned int DumpManager::getVariable(QueryPatterns &patterns, const std::string &variable) const
+{
+    auto it = std::find(patterns.variables.begin(), patterns.variables.end(), variable);
+    if (it != patterns.variables.end())
+    {
+        return static_cast<unsigned int>(it - patterns.variables.begin());
+    }
+
+    patterns.variables.push_back(variable);
+    return static_cast<unsigned int>(patterns.variables.size() - 1);
+}
+
+void DumpManager::matchPatterns(const QueryPatterns &patterns, std::vector<bool> &matched,
+                                std::vector<unsigned int> &bindings, const BindingHandler &bindingHandler) const
+{
+    // Next pattern: VALUES blocks first, then the triple pattern with the most bound positions (a bound predicate
+    // allows to use the indexes)
+    unsigned long valuesCount(patterns.values.size());
+    long next(-1);
+    int nextBound(-1);
+
+    for (unsigned long i = 0; i < matched.size(); i++)
+    {
+        if (matched[i])
+        {
+            continue;
+        }
+
+        if (i < valuesCount)
+        {
+            next = static_cast<long>(i);
+            break;
+        }
+
+        const TriplePattern &pattern = patterns.triples[i - valuesCount];
+        int bound(0);
+        for (unsigned long k = 0; k < 3; k++)
+        {
+            if (!pattern.variable[k] || bindings[pattern.value[k]] != UNBOUND)
+            {
+                bound += (k == 1) ? 2 : 1;
+            }
+        }
+
+        if (bound > nextBound)
+        {
+            next = static_cast<long>(i);
+            nextBound = bound;
+        }
+    }
+
+    if (next < 0)
+    {
+        bindingHandler(bindings);
+        return;
+    }
+
+    matched[next] = true;
+
+    if (static_cast<unsigned long>(next) < valuesCount)
+    {
+        const auto &block = patterns.values[next];
+        unsigned int previous = bindings[block.first];
+
+        for (const auto &term : block.second)
+        {
+            if (previous == UNBOUND || previous == term)
+            {
+                bindings[block.first] = term;
+                matchPatterns(patterns, matched, bindings, bindingHandler);
+            }
+        }
+
+        bindings[block.first] = previous;
+    }
+
+    else
+    {
+        const TriplePattern &pattern = patterns.triples[next - valuesCount];
+        unsigned int terms[3];
+        for (unsigned long k = 0; k < 3; k++)
+        {
+            terms[k] = pattern.variable[k] ? bindings[pattern.value[k]] : pattern.value[k];
+        }
+
+        // Candidate triples
+        Triple key{terms[0], terms[1], terms[2]};
+        std::pair<std::vector<Triple>::const_iterator, std::vector<Triple>::const_iterator> range(m_triplesBySubject.begin(), m_triplesBySubject.end());
+
+        if (terms[1] != UNBOUND && terms[0] != UNBOUND)
+        {
+            range = std::equal_range(m_triplesBySubject.begin(), m_triplesBySubject.end(), key, [](const Triple &t1, const Triple &t2) {
+                return std::tie(t1.predicate, t1.subject) < std::tie(t2.predicate, t2.subject);
+            });
+        }
+
+        else if (terms[1] != UNBOUND && terms[2] != UNBOUND)
+        {
+            range = std::equal_range(m_triplesByObject.begin(), m_triplesByObject.end(), key, [](const Triple &t1, const Triple &t2) {
+                return std::tie(t1.predicate, t1.object) < std::tie(t2.predicate, t2.object);
+            });
+        }
+
+        else if (terms[1] != UNBOUND)
+        {
+            range = std::equal_range(m_triplesBySubject.begin(), m_triplesBySubject.end(), key, [](const Triple &t1, const Triple &t2) {
+                return t1.predicate < t2.predicate;
+            });
+        }
+
+        for (auto triple = range.first; triple != range.second; ++triple)
+        {
+            unsigned int values[3] = {triple->subject, triple->predicate, triple->object};
+            unsigned int newBindings[3];
+            unsigned long newBindingsCount(0);
+            bool consistent(true);
+
+            for (unsigned long k = 0; k < 3 && consistent; k++)
+            {
+                if (terms[k] != UNBOUND)
+                {
+                    consistent = (values[k] == terms[k]);
+                }
+
+                // Unbound variable, possibly bound at a previous position of the same pattern
+                else if (bindings[pattern.value[k]] == UNBOUND)
+                {
+                    bindings[pattern.value[k]] = values[k];
+                    newBindings[newBindingsCount++] = pattern.value[k];
+                }
+
+                else
+                {
+                    consistent = (bindings[pattern.value[k]] == values[k]);
+                }
+            }
+
+            if (consistent)
+            {
+                matchPatterns(patterns, matched, bindings, bindingHandler);
+            }
+
+            for (unsigned long b = 0; b < newBindingsCount; b++)
+            {
+                bindings[newBindings[b]] = UNBOUND;
+            }
+        }
+    }
+
+    matched[next] = false;
+}
+
+std::string DumpManager::getValue(unsigned int term) const
+{
+    return m_terms.getElementFromIndex(term).substr(1);
+}
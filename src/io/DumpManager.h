@@ -0,0 +1,73 @@
+#ifndef TCN3R_DUMPMANAGER_H
+#define TCN3R_DUMPMANAGER_H
+
+
+#include <functional>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../configuration/Configuration.h"
+#include "CacheManager.h"
+#include "Logger.h"
+#include "TriplestoreManager.h"
+#include "TurtleParser.h"
+
+// Triple pattern of a where clause: each position is a variable (index in the query variables) or a term
+struct TriplePattern
+{
+    bool variable[3];
+    unsigned int value[3];
+};
+
+struct QueryPatterns
+{
+    std::vector<std::string> variables;
+    std::vector<TriplePattern> triples;
+
+    // VALUES blocks: variable and allowed terms
+    std::vector<std::pair<unsigned int, std::vector<unsigned int>>> values;
+
+    // A term of the where clause does not appear in the dump
+    bool unsatisfiable = false;
+};
+
+typedef std::function<void(const std::vector<unsigned int>&)> BindingHandler;
+
+// Triplestore read from a local N-Triples or Turtle dump
+// The file is memory-mapped and N-Triples dumps are parsed in parallel chunks. Where clauses are basic graph patterns
+// (triple patterns and VALUES blocks) evaluated against indexes of triples sorted by predicate
+class DumpManager : public TriplestoreManager
+{
+    public:
+        DumpManager(Configuration const &parameters, Logger const &logger);
+        virtual ~DumpManager();
+        virtual std::set<std::string> queryElements(const std::string &whereClause) const;
+        virtual std::set<std::pair<std::string, std::string>> queryTwoElements(const std::string &whereClause) const;
+        virtual void queryRows(const std::vector<std::string> &variables, const std::string &whereClause,
+                               const RowHandler &rowHandler) const;
+
+    private:
+        void loadNTriples(const char *begin, const char *end);
+        void loadTurtle(const char *begin, const char *end);
+        void parsingError(const char *begin, const char *position, const std::string &error) const;
+        QueryPatterns parseWhereClause(const std::string &whereClause) const;
+        bool findTerm(const std::string &token, const std::string &whereClause, unsigned int &term) const;
+        unsigned int getVariable(QueryPatterns &patterns, const std::string &variable) const;
+        void matchPatterns(const QueryPatterns &patterns, std::vector<bool> &matched, std::vector<unsigned int> &bindings,
+                           const BindingHandler &bindingHandler) const;
+        std::string getValue(unsigned int term) const;
+
+        Configuration const &m_parameters;
+        Logger const &m_logger;
+
+        CacheManager m_terms;
+
+        // Triples sorted by (predicate, subject, object) and by (predicate, object, subject)
+        std::vector<Triple> m_triplesBySubject;
+        std::vector<Triple> m_triplesByObject;
+};
+
+
+#endif //TCN3R_DUMPMANAGER_H
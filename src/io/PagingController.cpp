@@ -0,0 +1,73 @@
+#include <algorithm>
+
+#include "PagingController.h"
+
+
+PagingController::PagingController(Configuration const &parameters, Logger const &logger) :
+        m_parameters(parameters), m_logger(logger),
+        m_pageSize(static_cast<unsigned long>(parameters.getServerMaxRows())),
+        m_window(static_cast<unsigned long>(parameters.getServerParallelPages())), m_windowCredit(0)
+{
+
+}
+
+unsigned long PagingController::getPageSize() const
+{
+    return m_pageSize;
+}
+
+unsigned long PagingController::getWindow() const
+{
+    return m_window;
+}
+
+void PagingController::pageReceived(double seconds, bool fullPage)
+{
+    // A page that is not full tells nothing about the cost of larger pages
+    if (!m_parameters.isServerAdaptivePaging() || !fullPage)
+    {
+        return;
+    }
+
+    if (seconds * 1000.0 > m_parameters.getServerTargetLatency())
+    {
+        decreasePageSize();
+        return;
+    }
+
+    // Additive increase: min-rows more rows per page, one more page in flight once a whole window was received in time
+    m_pageSize = std::min(m_pageSize + static_cast<unsigned long>(m_parameters.getServerMinRows()),
+                          static_cast<unsigned long>(m_parameters.getServerMaxRows()));
+
+    if (++m_windowCredit >= m_window)
+    {
+        m_windowCredit = 0;
+        m_window = std::min(m_window + 1, static_cast<unsigned long>(m_parameters.getServerParallelPages()));
+    }
+}
+
+void PagingController::pageFailed()
+{
+    if (!m_parameters.isServerAdaptivePaging())
+    {
+        return;
+    }
+
+    m_windowCredit = 0;
+    m_window = std::max(m_window / 2, 1UL);
+
+    decreasePageSize();
+}
+
+void PagingController::decreasePageSize()
+{
+    unsigned long pageSize = std::max(m_pageSize / 2, static_cast<unsigned long>(m_parameters.getServerMinRows()));
+    if (pageSize == m_pageSize)
+    {
+        return;
+    }
+
+    m_pageSize = pageSize;
+    m_logger.info("Pages reduced to " + std::to_string(m_pageSize) + " rows, " + std::to_string(m_window)
+                  + " in flight");
+}
@@ -0,0 +1,35 @@
+#ifndef TCN3R_PAGINGCONTROLLER_H
+#define TCN3R_PAGINGCONTROLLER_H
+
+
+#include "../configuration/Configuration.h"
+#include "Logger.h"
+
+// AIMD controller of the size of pages and of the number of pages in flight, shared by all the queries sent to the
+// endpoint: both grow additively while full pages are received within the target latency, the page size is halved
+// when a full page is slow and both are halved when a page fails. They stay between min-rows and max-rows, and between
+// 1 and parallel-pages. When adaptive paging is disabled, max-rows and parallel-pages are always used.
+class PagingController
+{
+    public:
+        PagingController(Configuration const &parameters, Logger const &logger);
+        unsigned long getPageSize() const;
+        unsigned long getWindow() const;
+        void pageReceived(double seconds, bool fullPage);
+        void pageFailed();
+
+    private:
+        void decreasePageSize();
+
+        Configuration const &m_parameters;
+        Logger const &m_logger;
+
+        unsigned long m_pageSize;
+        unsigned long m_window;
+
+        // Full pages received in time since the last increase of the window
+        unsigned long m_windowCredit;
+};
+
+
+#endif //TCN3R_PAGINGCONTROLLER_H
@@ -0,0 +1,16 @@
+#include "QueryFailed.h"
+
+#include <utility>
+
+QueryFailed::QueryFailed(std::string message) noexcept : std::exception(), m_message(std::move(message))
+{
+
+}
+
+QueryFailed::~QueryFailed() noexcept
+= default;
+
+const char* QueryFailed::what() const noexcept
+{
+    return m_message.c_str();
+}
@@ -0,0 +1,22 @@
+#ifndef TCN3R_QUERYFAILED_H
+#define TCN3R_QUERYFAILED_H
+
+
+#include <exception>
+#include <string>
+
+// Query to the triplestore that cannot be answered: thrown instead of exiting, since queries may run in the fetching
+// thread of TriplestoreManager::queryRowsPipelined
+class QueryFailed : public std::exception
+{
+    public:
+        QueryFailed(std::string message) noexcept;
+        virtual ~QueryFailed() noexcept;
+        virtual const char* what() const noexcept;
+
+    private:
+        const std::string m_message;
+};
+
+
+#endif //TCN3R_QUERYFAILED_H
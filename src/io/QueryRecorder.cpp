@@ -0,0 +1,80 @@
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <utility>
+
+#include "QueryRecorder.h"
+
+
+QueryRecorder::QueryRecorder(std::string directory, Logger const &logger) : m_directory(std::move(directory)),
+                                                                            m_logger(logger)
+{
+
+}
+
+void QueryRecorder::record(const std::string &query, const std::string &contentType, const std::string &body) const
+{
+    std::error_code error;
+    std::filesystem::create_directories(m_directory, error);
+    if (error)
+    {
+        m_logger.critical("Not possible to create record directory: " + m_directory);
+        std::exit(-1);
+    }
+
+    std::string path = m_directory + "/" + getKey(query);
+    std::ofstream queryStream(path + ".rq", std::ios::binary | std::ios::trunc);
+    std::ofstream responseStream(path + ".res", std::ios::binary | std::ios::trunc);
+    if (!queryStream || !responseStream)
+    {
+        m_logger.critical("Not possible to write record: " + path);
+        std::exit(-1);
+    }
+
+    queryStream << query;
+    responseStream << contentType << "\n" << body;
+}
+
+bool QueryRecorder::find(const std::string &query, std::string &contentType, std::string &body) const
+{
+    std::string path = m_directory + "/" + getKey(query);
+    std::ifstream queryStream(path + ".rq", std::ios::binary);
+    std::ifstream responseStream(path + ".res", std::ios::binary);
+    if (!queryStream || !responseStream)
+    {
+        return false;
+    }
+
+    // Two queries may share a key: the recorded query must be the same
+    std::string recordedQuery((std::istreambuf_iterator<char>(queryStream)), std::istreambuf_iterator<char>());
+    if (recordedQuery != query)
+    {
+        return false;
+    }
+
+    std::getline(responseStream, contentType);
+    body.assign((std::istreambuf_iterator<char>(responseStream)), std::istreambuf_iterator<char>());
+    return true;
+}
+
+std::string QueryRecorder::getKey(const std::string &query)
+{
+    // 64-bit FNV-1a hash of the query, in hexadecimal
+    std::uint64_t hash(14695981039346656037ULL);
+    for (const auto &c : query)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ULL;
+    }
+
+    static const char digits[] = "0123456789abcdef";
+    std::string key(16, '0');
+    for (int i = 15; i >= 0; i--)
+    {
+        key[i] = digits[hash & 0xF];
+        hash >>= 4;
+    }
+
+    return key;
+}
@@ -0,0 +1,25 @@
+#ifndef TCN3R_QUERYRECORDER_H
+#define TCN3R_QUERYRECORDER_H
+
+
+#include <string>
+
+#include "Logger.h"
+
+// Query/response pairs stored in a directory, one pair per SPARQL query sent to the endpoint: <key>.rq holds the query
+// and <key>.res the content type of the response on its first line, followed by the (decompressed) body of the response
+class QueryRecorder
+{
+    public:
+        QueryRecorder(std::string directory, Logger const &logger);
+        void record(const std::string &query, const std::string &contentType, const std::string &body) const;
+        bool find(const std::string &query, std::string &contentType, std::string &body) const;
+        static std::string getKey(const std::string &query);
+
+    private:
+        std::string m_directory;
+        Logger const &m_logger;
+};
+
+
+#endif //TCN3R_QUERYRECORDER_H
@@ -0,0 +1,232 @@
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include "QueryTelemetry.h"
+
+
+QueryTelemetry::QueryTelemetry() : m_queries(), m_depth(0), m_start()
+{
+
+}
+
+void QueryTelemetry::startQuery(const std::string &query)
+{
+    if (m_depth++ == 0)
+    {
+        m_queries.emplace_back();
+        m_queries.back().query = query;
+        m_start = std::chrono::steady_clock::now();
+    }
+}
+
+void QueryTelemetry::addPage(const PageStatistics &page)
+{
+    if (!m_queries.empty())
+    {
+        m_queries.back().pages.push_back(page);
+    }
+}
+
+void QueryTelemetry::endQuery()
+{
+    if (--m_depth == 0)
+    {
+        std::chrono::duration<double> time = std::chrono::steady_clock::now() - m_start;
+        m_queries.back().time = time.count();
+    }
+}
+
+std::string QueryTelemetry::toString() const
+{
+    std::ostringstream table;
+    table << std::fixed << std::setprecision(3);
+    table << "Queries to the triplestore:" << std::endl;
+    table << std::setw(4) << "#" << std::setw(7) << "pages" << std::setw(9) << "retries" << std::setw(11) << "rows"
+          << std::setw(13) << "bytes" << std::setw(10) << "time (s)" << std::setw(10) << "TTFB (s)" << std::setw(11)
+          << "rows/s" << std::setw(10) << "MB/s" << "  query" << std::endl;
+
+    std::vector<unsigned long> histogram(LATENCY_BUCKETS, 0);
+    QueryStatistics total;
+
+    for (unsigned long i = 0; i <= m_queries.size(); i++)
+    {
+        // Last line: all queries
+        const QueryStatistics &q = (i < m_queries.size()) ? m_queries[i] : total;
+
+        unsigned long rows(0), bytes(0);
+        int retries(0);
+        double firstByteTime(0.0);
+        for (const auto &page : q.pages)
+        {
+            rows += page.rows;
+            bytes += page.bytes;
+            retries += page.retries;
+            firstByteTime = std::max(firstByteTime, page.firstByteTime);
+
+            if (i < m_queries.size())
+            {
+                addToHistogram(histogram, page.time);
+                total.pages.push_back(page);
+            }
+        }
+
+        if (i < m_queries.size())
+        {
+            total.time += q.time;
+        }
+
+        double rowsRate = (q.time > 0.0) ? static_cast<double>(rows) / q.time : 0.0;
+        double bytesRate = (q.time > 0.0) ? static_cast<double>(bytes) / q.time / 1000000.0 : 0.0;
+        std::string query = (i < m_queries.size()) ? q.query : std::string("(total)");
+        if (query.size() > 80)
+        {
+            query = query.substr(0, 77) + "...";
+        }
+
+        table << std::setw(4) << ((i < m_queries.size()) ? std::to_string(i + 1) : std::string("")) << std::setw(7)
+              << q.pages.size() << std::setw(9) << retries << std::setw(11) << rows << std::setw(13) << bytes
+              << std::setw(10) << q.time << std::setw(10) << firstByteTime << std::setw(11) << std::setprecision(0)
+              << rowsRate << std::setw(10) << std::setprecision(3) << bytesRate << "  " << query << std::endl;
+    }
+
+    table << "Latency of pages:" << std::endl;
+    for (unsigned long b = 0; b < LATENCY_BUCKETS; b++)
+    {
+        if (histogram[b] != 0)
+        {
+            table << ((b + 1 < LATENCY_BUCKETS) ? "  < " : "  >= ") << std::setw(6)
+                  << (1UL << ((b + 1 < LATENCY_BUCKETS) ? b : b - 1)) << " ms: " << histogram[b] << std::endl;
+        }
+    }
+
+    return table.str();
+}
+
+void QueryTelemetry::writeReport(const std::string &path, const Logger &logger) const
+{
+    std::ofstream report(path);
+    if (!report)
+    {
+        logger.error("Not possible to open telemetry report file: " + path);
+        return;
+    }
+
+    std::vector<unsigned long> totalHistogram(LATENCY_BUCKETS, 0);
+
+    report << std::setprecision(6) << "{\n  \"queries\": [";
+    for (unsigned long i = 0; i < m_queries.size(); i++)
+    {
+        const QueryStatistics &q = m_queries[i];
+        std::vector<unsigned long> histogram(LATENCY_BUCKETS, 0);
+
+        report << ((i == 0) ? "\n" : ",\n") << "    {\"query\": " << escapeJson(q.query) << ", \"time\": " << q.time
+               << ", \"pages\": [";
+
+        for (unsigned long j = 0; j < q.pages.size(); j++)
+        {
+            const PageStatistics &p = q.pages[j];
+            addToHistogram(histogram, p.time);
+            addToHistogram(totalHistogram, p.time);
+
+            report << ((j == 0) ? "\n" : ",\n") << "      {\"offset\": " << p.offset << ", \"limit\": " << p.limit
+                   << ", \"time\": " << p.time << ", \"first_byte_time\": " << p.firstByteTime << ", \"bytes\": "
+                   << p.bytes << ", \"decoded_bytes\": " << p.decodedBytes << ", \"rows\": " << p.rows
+                   << ", \"retries\": " << p.retries << "}";
+        }
+
+        report << (q.pages.empty() ? "" : "\n    ") << "], \"latency_histogram\": [";
+        for (unsigned long b = 0; b < LATENCY_BUCKETS; b++)
+        {
+            report << ((b == 0) ? "" : ", ") << histogram[b];
+        }
+
+        report << "]}";
+    }
+
+    report << "\n  ],\n  \"latency_histogram_buckets_ms\": [";
+    for (unsigned long b = 0; b + 1 < LATENCY_BUCKETS; b++)
+    {
+        report << ((b == 0) ? "" : ", ") << (1UL << b);
+    }
+
+    report << ", null],\n  \"latency_histogram\": [";
+    for (unsigned long b = 0; b < LATENCY_BUCKETS; b++)
+    {
+        report << ((b == 0) ? "" : ", ") << totalHistogram[b];
+    }
+
+    report << "]\n}\n";
+    logger.info("Telemetry report written in " + path);
+}
+
+void QueryTelemetry::addToHistogram(std::vector<unsigned long> &histogram, double seconds)
+{
+    unsigned long b(0);
+    double milliseconds = seconds * 1000.0;
+    while (b + 1 < LATENCY_BUCKETS && milliseconds >= static_cast<double>(1UL << b))
+    {
+        b++;
+    }
+
+    histogram[b]++;
+}
+
+std::string QueryTelemetry::escapeJson(const std::string &value)
+{
+    std::string escaped("\"");
+
+    for (const auto &c : value)
+    {
+        switch (c)
+        {
+            case '"':
+                escaped += "\\\"";
+                break;
+
+            case '\\':
+                escaped += "\\\\";
+                break;
+
+            case '\n':
+                escaped += "\\n";
+                break;
+
+            case '\r':
+                escaped += "\\r";
+                break;
+
+            case '\t':
+                escaped += "\\t";
+                break;
+
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    char unicode[7];
+                    std::snprintf(unicode, sizeof(unicode), "\\u%04x", static_cast<unsigned int>(c));
+                    escaped += unicode;
+                }
+
+                else
+                {
+                    escaped += c;
+                }
+        }
+    }
+
+    escaped += "\"";
+    return escaped;
+}
+
+QueryTelemetryScope::QueryTelemetryScope(QueryTelemetry &telemetry, const std::string &query) : m_telemetry(telemetry)
+{
+    m_telemetry.startQuery(query);
+}
+
+QueryTelemetryScope::~QueryTelemetryScope()
+{
+    m_telemetry.endQuery();
+}
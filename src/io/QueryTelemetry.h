@@ -0,0 +1,74 @@
+#ifndef TCN3R_QUERYTELEMETRY_H
+#define TCN3R_QUERYTELEMETRY_H
+
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "Logger.h"
+
+// Latency histogram of pages: bucket i counts pages received in less than 2^i ms (the last one counts slower pages)
+#define LATENCY_BUCKETS 16
+
+struct PageStatistics
+{
+    unsigned long offset = 0;
+    unsigned long limit = 0;
+
+    // Seconds from the start of the (last) try to its last byte and to its first byte
+    double time = 0.0;
+    double firstByteTime = 0.0;
+
+    // Bytes received (compressed) and given to the results parser (decompressed)
+    unsigned long bytes = 0;
+    unsigned long decodedBytes = 0;
+
+    unsigned long rows = 0;
+    int retries = 0;
+};
+
+struct QueryStatistics
+{
+    std::string query;
+    double time = 0.0;
+    std::vector<PageStatistics> pages;
+};
+
+// Statistics of the logical queries sent to the endpoint (a logical query may send several paged SPARQL queries)
+class QueryTelemetry
+{
+    public:
+        QueryTelemetry();
+        void startQuery(const std::string &query);
+        void addPage(const PageStatistics &page);
+        void endQuery();
+        std::string toString() const;
+        void writeReport(const std::string &path, const Logger &logger) const;
+
+    private:
+        static void addToHistogram(std::vector<unsigned long> &histogram, double seconds);
+        static std::string escapeJson(const std::string &value);
+
+        std::vector<QueryStatistics> m_queries;
+
+        // Nested logical queries (e.g., the count query of a paged query) belong to the outermost one
+        int m_depth;
+        std::chrono::steady_clock::time_point m_start;
+};
+
+// Records a logical query in the telemetry for the lifetime of the scope
+class QueryTelemetryScope
+{
+    public:
+        QueryTelemetryScope(QueryTelemetry &telemetry, const std::string &query);
+        QueryTelemetryScope(const QueryTelemetryScope&) = delete;
+        QueryTelemetryScope& operator=(const QueryTelemetryScope&) = delete;
+        ~QueryTelemetryScope();
+
+    private:
+        QueryTelemetry &m_telemetry;
+};
+
+
+#endif //TCN3R_QUERYTELEMETRY_H
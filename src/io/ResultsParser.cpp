@@ -0,0 +1,89 @@
+#include <utility>
+
+#include "ResultsParser.h"
+#include "SparqlJsonParser.h"
+#include "SparqlSeparatedValuesParser.h"
+
+
+ResultsParser* ResultsParser::fromContentType(const std::string &contentType, std::vector<std::string> variables,
+                                              RowHandler rowHandler)
+{
+    if (contentType.find("text/tab-separated-values") != std::string::npos)
+    {
+        return new SparqlSeparatedValuesParser(TSV_RESULTS, std::move(variables), std::move(rowHandler));
+    }
+
+    if (contentType.find("text/csv") != std::string::npos)
+    {
+        return new SparqlSeparatedValuesParser(CSV_RESULTS, std::move(variables), std::move(rowHandler));
+    }
+
+    // JSON is the fallback whenever the endpoint does not announce one of the other formats
+    return new SparqlJsonParser(std::move(variables), std::move(rowHandler));
+}
+
+ResultsParser::ResultsParser(std::vector<std::string> variables, RowHandler rowHandler) :
+        m_variables(std::move(variables)), m_rowHandler(std::move(rowHandler)), m_row(m_variables.size()),
+        m_rowsCount(0), m_error()
+{
+
+}
+
+ResultsParser::~ResultsParser()
+= default;
+
+void ResultsParser::finish()
+{
+
+}
+
+unsigned long ResultsParser::getRowsCount() const
+{
+    return m_rowsCount;
+}
+
+std::string ResultsParser::getError() const
+{
+    if (!m_error.empty())
+        return m_error;
+
+    if (!isComplete())
+        return "truncated document";
+
+    return "";
+}
+
+void ResultsParser::emitRow()
+{
+    m_rowHandler(m_row);
+    m_rowsCount++;
+}
+
+void ResultsParser::appendUtf8(std::string &output, unsigned long codePoint)
+{
+    if (codePoint < 0x80)
+    {
+        output += static_cast<char>(codePoint);
+    }
+
+    else if (codePoint < 0x800)
+    {
+        output += static_cast<char>(0xC0 | (codePoint >> 6));
+        output += static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+
+    else if (codePoint < 0x10000)
+    {
+        output += static_cast<char>(0xE0 | (codePoint >> 12));
+        output += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        output += static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+
+    else
+    {
+        output += static_cast<char>(0xF0 | (codePoint >> 18));
+        output += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+        output += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        output += static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+}
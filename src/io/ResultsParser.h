@@ -0,0 +1,40 @@
+#ifndef TCN3R_RESULTSPARSER_H
+#define TCN3R_RESULTSPARSER_H
+
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+typedef std::function<void(const std::vector<std::string>&)> RowHandler;
+
+// Incremental parser of SPARQL results: chunks are fed as they are received and each result is given to the row
+// handler as soon as it is complete, with the values of the requested variables in the order of the variables
+class ResultsParser
+{
+    public:
+        static ResultsParser* fromContentType(const std::string &contentType, std::vector<std::string> variables,
+                                              RowHandler rowHandler);
+
+        ResultsParser(std::vector<std::string> variables, RowHandler rowHandler);
+        virtual ~ResultsParser();
+        virtual void feed(const char *data, size_t size) = 0;
+        virtual void finish();
+        virtual bool isComplete() const = 0;
+        unsigned long getRowsCount() const;
+        std::string getError() const;
+        static void appendUtf8(std::string &output, unsigned long codePoint);
+
+    protected:
+        void emitRow();
+
+        const std::vector<std::string> m_variables;
+        const RowHandler m_rowHandler;
+        std::vector<std::string> m_row;
+        unsigned long m_rowsCount;
+        std::string m_error;
+};
+
+
+#endif //TCN3R_RESULTSPARSER_H
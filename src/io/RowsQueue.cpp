@@ -0,0 +1,81 @@
+#include <utility>
+
+#include "RowsQueue.h"
+
+
+RowsQueue::RowsQueue(unsigned long capacity) : m_capacity((capacity > 0) ? capacity : 1), m_chunks(), m_closed(false),
+                                               m_cancelled(false), m_error(), m_mutex(), m_notFull(), m_notEmpty()
+{
+
+}
+
+bool RowsQueue::push(RowsChunk &&chunk)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_notFull.wait(lock, [this]() { return m_chunks.size() < m_capacity || m_cancelled; });
+
+    // Cancelled by the consumer: rows are not needed anymore
+    if (m_cancelled)
+    {
+        return false;
+    }
+
+    m_chunks.push_back(std::move(chunk));
+    m_notEmpty.notify_one();
+
+    return true;
+}
+
+bool RowsQueue::pop(RowsChunk &chunk)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_notEmpty.wait(lock, [this]() { return !m_chunks.empty() || m_closed; });
+
+    if (m_error)
+    {
+        std::rethrow_exception(m_error);
+    }
+
+    // Closed and empty: no more rows
+    if (m_chunks.empty())
+    {
+        return false;
+    }
+
+    chunk = std::move(m_chunks.front());
+    m_chunks.pop_front();
+    m_notFull.notify_one();
+
+    return true;
+}
+
+void RowsQueue::close(std::exception_ptr error)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_closed = true;
+    m_error = std::move(error);
+    m_notEmpty.notify_all();
+}
+
+void RowsQueue::cancel()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_cancelled = true;
+    m_chunks.clear();
+    m_notFull.notify_all();
+}
+
+RowsProducerGuard::RowsProducerGuard(RowsQueue &queue, std::thread &producer) : m_queue(queue), m_producer(producer)
+{
+
+}
+
+RowsProducerGuard::~RowsProducerGuard()
+{
+    m_queue.cancel();
+
+    if (m_producer.joinable())
+    {
+        m_producer.join();
+    }
+}
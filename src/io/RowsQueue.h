@@ -0,0 +1,59 @@
+#ifndef TCN3R_ROWSQUEUE_H
+#define TCN3R_ROWSQUEUE_H
+
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+typedef std::vector<std::vector<std::string>> RowsChunk;
+
+// Bounded queue of chunks of rows between a producer (fetching and parsing rows) and a consumer (building the graph):
+// the producer waits while the queue is full, the consumer waits while it is empty and not closed. The producer closes
+// the queue with its failure if it has one (rethrown by pop), the consumer cancels it if it stops early (push returns
+// false)
+class RowsQueue
+{
+    public:
+        explicit RowsQueue(unsigned long capacity);
+        RowsQueue(const RowsQueue&) = delete;
+        RowsQueue& operator=(const RowsQueue&) = delete;
+        bool push(RowsChunk &&chunk);
+        bool pop(RowsChunk &chunk);
+        void close(std::exception_ptr error = nullptr);
+        void cancel();
+
+    private:
+        const unsigned long m_capacity;
+        std::deque<RowsChunk> m_chunks;
+        bool m_closed;
+        bool m_cancelled;
+        std::exception_ptr m_error;
+
+        std::mutex m_mutex;
+        std::condition_variable m_notFull;
+        std::condition_variable m_notEmpty;
+};
+
+
+// Producer thread of a queue, joined when the consumer leaves (normally or by an exception) after cancelling the queue:
+// a producer waiting for room, or still fetching rows, stops
+class RowsProducerGuard
+{
+    public:
+        RowsProducerGuard(RowsQueue &queue, std::thread &producer);
+        RowsProducerGuard(const RowsProducerGuard&) = delete;
+        RowsProducerGuard& operator=(const RowsProducerGuard&) = delete;
+        ~RowsProducerGuard();
+
+    private:
+        RowsQueue &m_queue;
+        std::thread &m_producer;
+};
+
+
+#endif //TCN3R_ROWSQUEUE_H
@@ -1,214 +1,785 @@
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
+#include <limits>
+#include <list>
+#include <sstream>
 
 #include <boost/progress.hpp>
-#include <boost/property_tree/json_parser.hpp>
 
+#include "QueryFailed.h"
 #include "ServerManager.h"
 
 
-ServerManager::ServerManager(Configuration const &parameters, Logger const &logger) : m_parameters(parameters), m_logger(logger)
+ServerManager::ServerManager(Configuration const &parameters, Logger const &logger) : m_parameters(parameters), m_logger(logger),
+                                                                                     m_multi(nullptr), m_handlesPool(),
+                                                                                     m_headers(nullptr), m_urlPrefix(),
+                                                                                     m_pagingController(parameters, logger),
+                                                                                     m_telemetry(), m_recorder()
 {
+    // The multi handle lives as long as the ServerManager: it holds the connection cache that keeps connections to
+    // the endpoint alive between queries
+    m_multi = curl_multi_init();
+    if (!m_multi)
+    {
+        logger.critical("Error while initializing CURL multi handle");
+        std::exit(-1);
+    }
+
+    if (m_parameters.isServerHttp2())
+    {
+        curl_multi_setopt(m_multi, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+    }
+
+    if (m_parameters.getServerQueryMethod() == POST)
+    {
+        m_headers = curl_slist_append(m_headers, "Content-Type: application/sparql-query");
+    }
+
+    // JSON stays acceptable: the parser is chosen according to the content type of each response
+    if (m_parameters.getServerResultFormat() != JSON_RESULTS)
+    {
+        std::string accept = "Accept: " + getFormatValue() + ", application/sparql-results+json;q=0.5";
+        m_headers = curl_slist_append(m_headers, accept.c_str());
+    }
+
+    // Constant part of the URL, the query is appended to it for GET requests
+    CURL *curl = acquireHandle();
+    m_urlPrefix = m_parameters.getServerAddress() + "?"
+            + escapeUrl(curl, m_parameters.getServerJsonAttribute()) + "="
+            + escapeUrl(curl, getFormatValue()) + "&"
+            + escapeUrl(curl, m_parameters.getServerGraphAttribute()) + "="
+            + escapeUrl(curl, m_parameters.getServerGraphValue());
+    releaseHandle(curl);
 
+    if (!m_parameters.getRecordDirectory().empty())
+    {
+        m_recorder.reset(new QueryRecorder(m_parameters.getRecordDirectory(), logger));
+    }
 }
 
-boost::property_tree::ptree ServerManager::query(std::string const &sparqlQuery) const
+ServerManager::~ServerManager()
 {
-    CURL *curl;
-    boost::property_tree::ptree jsonTree;
+    for (const auto &curl : m_handlesPool)
+    {
+        curl_easy_cleanup(curl);
+    }
 
-    curl = curl_easy_init();
-    if (curl)
+    curl_multi_cleanup(m_multi);
+    curl_slist_free_all(m_headers);
+}
+
+void ServerManager::query(std::string const &sparqlQuery, const std::vector<std::string> &variables,
+                          const RowHandler &rowHandler) const
+{
+    QueryTelemetryScope telemetryScope(m_telemetry, sparqlQuery);
+    queryPages(variables, [&sparqlQuery](unsigned long offset, unsigned long limit) { return sparqlQuery; },
+               std::numeric_limits<unsigned long>::max(), false, rowHandler,
+               [](unsigned long limit, unsigned long rowsCount) { return false; });
+}
+
+int ServerManager::queryCountElements(const std::string& whereClause) const
+{
+    int count(0);
+    query("SELECT COUNT(DISTINCT ?e) as ?count WHERE { " + whereClause + " } ", {"count"},
+          [&count](const std::vector<std::string> &row) { count = std::stoi(row[0]); });
+    return count;
+}
+
+int ServerManager::queryCountTwoElements(const std::string &whereClause) const
+{
+    int count(0);
+    query("SELECT COUNT(*) as ?count WHERE { SELECT DISTINCT ?e1 ?e2 WHERE { " + whereClause + " }}", {"count"},
+          [&count](const std::vector<std::string> &row) { count = std::stoi(row[0]); });
+    return count;
+}
+
+std::set<std::string> ServerManager::queryElements(const std::string &whereClause) const
+{
+    QueryTelemetryScope telemetryScope(m_telemetry, "SELECT DISTINCT ?e WHERE { " + whereClause + " }");
+    std::set<std::string> elements;
+
+    if (m_parameters.getServerPagination() != OFFSET)
     {
-        bool done(false);
+        queryOrderedElements({"e"}, whereClause, [&elements](const std::vector<std::string> &row) {
+            elements.insert(row[0]);
+        });
 
-        // Prepare URL
-        std::string url = m_parameters.getServerAddress() + "?"
-                + escapeUrl(curl, m_parameters.getServerJsonAttribute()) + "="
-                + escapeUrl(curl, m_parameters.getServerJsonValue()) + "&"
-                + escapeUrl(curl, m_parameters.getServerGraphAttribute()) + "="
-                + escapeUrl(curl, m_parameters.getServerGraphValue()) + "&"
-                + escapeUrl(curl, m_parameters.getServerQueryAttribute()) + "="
-                + escapeUrl(curl, sparqlQuery);
-        curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+        return elements;
+    }
+
+    auto elementsCount = static_cast<unsigned int>(queryCountElements(whereClause));
+
+    while (elements.size() != elementsCount)
+    {
+        elements.clear();
+        boost::progress_display progressBar(elementsCount);
+
+        queryPages({"e"}, [this, &whereClause](unsigned long offset, unsigned long limit) {
+            std::ostringstream queryStream;
+            queryStream << "SELECT DISTINCT ?e WHERE { " << whereClause << " } ";
+            queryStream << "LIMIT " << limit << " OFFSET " << offset;
+            return queryStream.str();
+        }, elementsCount, true,
+        [&elements, &progressBar](const std::vector<std::string> &row) {
+            elements.insert(row[0]);
+            ++progressBar;
+        },
+        [](unsigned long limit, unsigned long rowsCount) { return true; });
+
+        if (elements.size() != elementsCount)
+        {
+            std::cerr << "Number of elements different from count, retry..." << std::endl;
+        }
+    }
+
+    return elements;
+}
+
+std::set<std::pair<std::string, std::string>> ServerManager::queryTwoElements(const std::string &whereClause) const
+{
+    QueryTelemetryScope telemetryScope(m_telemetry, "SELECT DISTINCT ?e1 ?e2 WHERE { " + whereClause + " }");
+    std::set<std::pair<std::string, std::string>> elements;
+
+    if (m_parameters.getServerPagination() != OFFSET)
+    {
+        queryOrderedElements({"e1", "e2"}, whereClause, [&elements](const std::vector<std::string> &row) {
+            elements.insert(std::pair<std::string, std::string>(row[0], row[1]));
+        });
+
+        return elements;
+    }
+
+    auto elementsCount = static_cast<unsigned int>(queryCountTwoElements(whereClause));
+
+    while (elements.size() != elementsCount)
+    {
+        elements.clear();
+        boost::progress_display progressBar(elementsCount);
+
+        queryPages({"e1", "e2"}, [this, &whereClause](unsigned long offset, unsigned long limit) {
+            std::ostringstream queryStream;
+            queryStream << "SELECT DISTINCT ?e1 ?e2 WHERE { " << whereClause << " } ";
+            queryStream << "LIMIT " << limit << " OFFSET " << offset;
+            return queryStream.str();
+        }, elementsCount, true,
+        [&elements, &progressBar](const std::vector<std::string> &row) {
+            elements.insert(std::pair<std::string, std::string>(row[0], row[1]));
+            ++progressBar;
+        },
+        [](unsigned long limit, unsigned long rowsCount) { return true; });
+
+        if (elements.size() != elementsCount)
+        {
+            std::cerr << "Number of elements different from count, retry..." << std::endl;
+        }
+    }
+
+    return elements;
+}
+
+void ServerManager::queryRows(const std::vector<std::string> &variables, const std::string &whereClause,
+                              const RowHandler &rowHandler) const
+{
+    std::string selectedVariables;
+    for (const auto &v : variables)
+    {
+        selectedVariables += " ?" + v;
+    }
 
-        // Set up timeout
-        curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, m_parameters.getServerTimeout());
+    QueryTelemetryScope telemetryScope(m_telemetry, "SELECT DISTINCT" + selectedVariables + " WHERE { " + whereClause + " }");
+
+    // Distinct rows are given to the row handler as soon as they are received
+    if (m_parameters.getServerPagination() != OFFSET)
+    {
+        queryOrderedElements(variables, whereClause, rowHandler);
+        return;
+    }
+
+    // Pages are not stable between queries: rows are given to the row handler as they are received (it has to
+    // ignore duplicates) and all pages are fetched again until the number of distinct rows matches the count. Only
+    // 128-bit hashes of the rows are kept to count them
+    auto rowsCount = static_cast<unsigned long>(queryCountRows(variables, whereClause));
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> rowHashes;
+
+    while (true)
+    {
+        rowHashes.clear();
+        boost::progress_display progressBar(rowsCount);
+
+        queryPages(variables, [this, &variables, &whereClause](unsigned long offset, unsigned long limit) {
+            std::ostringstream queryStream;
+            queryStream << "SELECT DISTINCT";
+            for (const auto &v : variables)
+            {
+                queryStream << " ?" << v;
+            }
 
-        // Set up authentication (if needed)
-        if (!m_parameters.getServerUsername().empty() && !m_parameters.getServerPassword().empty())
+            queryStream << " WHERE { " << whereClause << " } ";
+            queryStream << "LIMIT " << limit << " OFFSET " << offset;
+            return queryStream.str();
+        }, rowsCount, true,
+        [&rowHandler, &rowHashes, &progressBar](const std::vector<std::string> &row) {
+            rowHashes.push_back(hashRow(row));
+            rowHandler(row);
+            ++progressBar;
+        },
+        [](unsigned long limit, unsigned long rowsCount) { return true; });
+
+        std::sort(rowHashes.begin(), rowHashes.end());
+        if (static_cast<unsigned long>(std::unique(rowHashes.begin(), rowHashes.end()) - rowHashes.begin()) == rowsCount)
         {
-            std::string authentication = m_parameters.getServerUsername() + ":" + m_parameters.getServerPassword();
-            curl_easy_setopt(curl, CURLOPT_USERPWD, authentication.c_str());
+            break;
         }
 
-        // Set up content receiver
-        std::string queryResponse;
-        curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, queryCallback);
-        curl_easy_setopt(curl, CURLOPT_WRITEDATA, &queryResponse);
+        std::cerr << "Number of elements different from count, retry..." << std::endl;
+    }
+}
 
-        while (!done)
+std::pair<std::uint64_t, std::uint64_t> ServerManager::hashRow(const std::vector<std::string> &row)
+{
+    // A 64-bit FNV-1a hash and a 64-bit multiplicative hash, values are separated by a byte outside of UTF-8
+    std::uint64_t hash1(14695981039346656037ULL), hash2(0);
+    for (const auto &value : row)
+    {
+        for (const auto &c : value)
         {
-            done = true;
+            hash1 = (hash1 ^ static_cast<unsigned char>(c)) * 1099511628211ULL;
+            hash2 = (hash2 ^ static_cast<unsigned char>(c)) * 0x9E3779B97F4A7C15ULL;
+            hash2 ^= hash2 >> 32;
+        }
+
+        hash1 = (hash1 ^ 0xFF) * 1099511628211ULL;
+        hash2 = (hash2 ^ 0xFF) * 0x9E3779B97F4A7C15ULL;
+    }
+
+    return {hash1, hash2};
+}
+
+int ServerManager::queryCountRows(const std::vector<std::string> &variables, const std::string &whereClause) const
+{
+    std::string selectedVariables;
+    for (const auto &v : variables)
+    {
+        selectedVariables += " ?" + v;
+    }
+
+    int count(0);
+    query("SELECT COUNT(*) as ?count WHERE { SELECT DISTINCT" + selectedVariables + " WHERE { " + whereClause + " }}",
+          {"count"}, [&count](const std::vector<std::string> &row) { count = std::stoi(row[0]); });
+    return count;
+}
+
+void ServerManager::queryOrderedElements(const std::vector<std::string> &variables, const std::string &whereClause,
+                                         const RowHandler &rowHandler) const
+{
+    // Pages are fetched in a stable order: a page that is not full ends the stream and a failed page is fetched
+    // again (see queryPages) without discarding the rows already received
+    if (m_parameters.getServerPagination() == ORDERED)
+    {
+        // Pages are independent: several of them can be in flight, pages after the end of results are empty
+        queryPages(variables, [this, &variables, &whereClause](unsigned long offset, unsigned long limit) {
+            return orderedPageQuery(variables, whereClause, std::vector<std::string>(), offset, limit);
+        }, std::numeric_limits<unsigned long>::max(), true, rowHandler,
+        [](unsigned long limit, unsigned long rowsCount) { return rowsCount == limit; });
+    }
 
-            // Perform query
-            CURLcode res = curl_easy_perform(curl);
+    else
+    {
+        // Each page starts after the last row of the previous one: pages are fetched one at a time
+        std::vector<std::string> lastKey;
+        bool fullPage(false);
 
-            // Check potential errors
-            if (res != CURLE_OK)
+        do
+        {
+            std::vector<std::string> lastRow;
+
+            queryPages(variables, [this, &variables, &whereClause, &lastKey](unsigned long offset, unsigned long limit) {
+                return orderedPageQuery(variables, whereClause, lastKey, 0, limit);
+            }, std::numeric_limits<unsigned long>::max(), false,
+            [&rowHandler, &lastRow](const std::vector<std::string> &row) {
+                rowHandler(row);
+                lastRow = row;
+            },
+            [&fullPage](unsigned long limit, unsigned long rowsCount) {
+                fullPage = (rowsCount == limit);
+                return false;
+            });
+
+            if (!lastRow.empty())
             {
-                m_logger.critical("CURL error " + std::string(curl_easy_strerror(res)));
-                std::exit(-1);
+                lastKey.swap(lastRow);
             }
+        } while (fullPage);
+    }
+}
+
+std::string ServerManager::orderedPageQuery(const std::vector<std::string> &variables, const std::string &whereClause,
+                                            const std::vector<std::string> &lastKey, unsigned long offset,
+                                            unsigned long limit) const
+{
+    std::ostringstream queryStream;
+    queryStream << "SELECT DISTINCT";
+    for (const auto &v : variables)
+    {
+        queryStream << " ?" << v;
+    }
+
+    queryStream << " WHERE { " << whereClause;
+    if (!lastKey.empty())
+    {
+        queryStream << " FILTER(" << keysetFilter(variables, lastKey) << ")";
+    }
+
+    queryStream << " } ORDER BY";
+    for (const auto &v : variables)
+    {
+        if (m_parameters.getServerPagination() == KEYSET)
+            queryStream << " STR(?" << v << ")";
+        else
+            queryStream << " ?" << v;
+    }
+
+    queryStream << " LIMIT " << limit;
+    if (m_parameters.getServerPagination() == ORDERED)
+    {
+        queryStream << " OFFSET " << offset;
+    }
 
-            else
+    return queryStream.str();
+}
+
+void ServerManager::queryPages(const std::vector<std::string> &variables, const PageQuery &pageQuery,
+                               unsigned long rowsCount, bool splitPages, const RowHandler &rowHandler,
+                               const PageHandler &pageHandler) const
+{
+    // Rows are given to the row handler while pages are received: the rows of a page that fails in the middle of its
+    // transfer may be given again when the page is tried again
+    std::list<PageTransfer> transfers;
+    unsigned long nextOffset(0);
+
+    // When the number of rows is unknown, pages are started speculatively: the number of transfers in flight grows
+    // with the number of pages received that announced further pages (slow start), to not flood the endpoint with
+    // empty pages for small results
+    bool knownRowsCount(rowsCount != std::numeric_limits<unsigned long>::max());
+    unsigned long continuedPages(0);
+
+    // Failures (of the queries or of the row handler) leave through exceptions: the transfers in flight are stopped
+    try
+    {
+        while (nextOffset < rowsCount || !transfers.empty())
+        {
+            // Failed pages waiting to be tried again are not needed anymore after the end of results
+            transfers.remove_if([rowsCount](const PageTransfer &t) { return !t.curl && t.offset >= rowsCount; });
+
+            // Keep up to the window of the paging controller in flight, failed pages first
+            unsigned long window = m_pagingController.getWindow();
+            if (!knownRowsCount)
             {
-                // Check HTTP status code
-                long httpCode(0);
-                res = curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &httpCode);
+                window = std::min(window, continuedPages + 1);
+            }
+
+            auto running = static_cast<unsigned long>(std::count_if(transfers.begin(), transfers.end(),
+                                                                     [](const PageTransfer &t) { return t.curl != nullptr; }));
 
-                if (res == CURLE_OK)
+            for (auto &t : transfers)
+            {
+                if (!t.curl && running < window)
                 {
-                    if (httpCode / 100 == 2) // 2xx codes
-                    {
-                        std::stringstream jsonStream;
-                        jsonStream << queryResponse;
-                        boost::property_tree::read_json(jsonStream, jsonTree);
-                    }
+                    startTransfer(t, pageQuery(t.offset, t.limit));
+                    running++;
+                }
+            }
+
+            while (nextOffset < rowsCount && running < window)
+            {
+                transfers.emplace_back();
+                transfers.back().offset = nextOffset;
+                transfers.back().limit = std::min(m_pagingController.getPageSize(), rowsCount - nextOffset);
+                transfers.back().variables = &variables;
+                transfers.back().rowHandler = &rowHandler;
+                startTransfer(transfers.back(), pageQuery(transfers.back().offset, transfers.back().limit));
+                running++;
+
+                // A page that is not split covers all the rows
+                nextOffset = splitPages ? nextOffset + transfers.back().limit : rowsCount;
+            }
+
+            if (transfers.empty())
+            {
+                break;
+            }
+
+            int stillRunning(0);
+            curl_multi_perform(m_multi, &stillRunning);
+
+            CURLMsg *message;
+            int queued(0);
+            while ((message = curl_multi_info_read(m_multi, &queued)))
+            {
+                if (message->msg != CURLMSG_DONE)
+                {
+                    continue;
+                }
+
+                CURL *curl(message->easy_handle);
+                CURLcode result(message->data.result);
+                PageTransfer *transfer(nullptr);
+                curl_easy_getinfo(curl, CURLINFO_PRIVATE, &transfer);
+                curl_multi_remove_handle(m_multi, curl);
 
-                    else if (httpCode / 100 == 3) // 3xx codes
+                TransferStatus status = completeTransfer(*transfer, result);
+
+                if (status == TRANSFER_DONE)
+                {
+                    unsigned long rowsReceived(transfer->parser->getRowsCount());
+
+                    curl_off_t time(0), firstByteTime(0), bytes(0);
+                    curl_easy_getinfo(curl, CURLINFO_TOTAL_TIME_T, &time);
+                    curl_easy_getinfo(curl, CURLINFO_STARTTRANSFER_TIME_T, &firstByteTime);
+                    curl_easy_getinfo(curl, CURLINFO_SIZE_DOWNLOAD_T, &bytes);
+
+                    PageStatistics page;
+                    page.offset = transfer->offset;
+                    page.limit = transfer->limit;
+                    page.time = static_cast<double>(time) / 1000000.0;
+                    page.firstByteTime = static_cast<double>(firstByteTime) / 1000000.0;
+                    page.bytes = static_cast<unsigned long>(bytes);
+                    page.decodedBytes = transfer->decodedBytes;
+                    page.rows = rowsReceived;
+                    page.retries = transfer->tries;
+                    m_telemetry.addPage(page);
+
+                    if (m_recorder)
                     {
-                        char *location(nullptr);
-                        res = curl_easy_getinfo(curl, CURLINFO_REDIRECT_URL, &location);
-
-                        if (res == CURLE_OK && location)
-                        {
-                            done = false;
-                            curl_easy_setopt(curl, CURLOPT_URL, location);
-                            queryResponse = "";
-                        }
-
-                        else
-                        {
-                            m_logger.critical("CURL error " + std::string(curl_easy_strerror(res)));
-                            std::exit(-1);
-                        }
+                        char *contentType(nullptr);
+                        curl_easy_getinfo(curl, CURLINFO_CONTENT_TYPE, &contentType);
+                        m_recorder->record(transfer->query, contentType ? contentType : "", transfer->response);
                     }
 
-                    else if (httpCode == 404) // 404 code
+                    m_pagingController.pageReceived(page.time, rowsReceived == transfer->limit);
+
+                    // A page handler returning false marks the last page: no later page is started
+                    if (pageHandler(transfer->limit, rowsReceived))
                     {
-                        done = false;
-                        m_logger.warning("New try after 404 error while querying triplestore");
+                        continuedPages++;
                     }
 
                     else
                     {
-                        m_logger.critical("HTTP error while querying triplestore " + std::to_string(httpCode));
-                        std::exit(-1);
+                        rowsCount = std::min(rowsCount, transfer->offset + transfer->limit);
                     }
+
+                    releaseHandle(curl);
+                    transfers.remove_if([transfer](const PageTransfer &t) { return &t == transfer; });
+                }
+
+                else if (status == TRANSFER_REDIRECTED)
+                {
+                    transfer->parser.reset();
+                    transfer->decodedBytes = 0;
+                    transfer->response.clear();
+                    curl_multi_add_handle(m_multi, curl);
                 }
 
                 else
                 {
-                    m_logger.critical("CURL error " + std::string(curl_easy_strerror(res)));
-                    std::exit(-1);
+                    transfer->tries++;
+
+                    if (transfer->tries > m_parameters.getServerMaxRetries())
+                    {
+                        std::string message("Query failed after " + std::to_string(transfer->tries) + " tries");
+                        m_logger.critical(message);
+                        throw QueryFailed(message);
+                    }
+
+                    m_logger.warning("New try (" + std::to_string(transfer->tries) + "/"
+                                     + std::to_string(m_parameters.getServerMaxRetries())
+                                     + ") after error while querying triplestore");
+
+                    // The page is tried again with the reduced page size, the rest of it is fetched as a new page
+                    m_pagingController.pageFailed();
+                    unsigned long limit = std::min(transfer->limit, m_pagingController.getPageSize());
+                    if (splitPages && limit < transfer->limit)
+                    {
+                        transfers.emplace_back();
+                        transfers.back().offset = transfer->offset + limit;
+                        transfers.back().limit = transfer->limit - limit;
+                        transfers.back().variables = &variables;
+                        transfers.back().rowHandler = &rowHandler;
+                    }
+
+                    transfer->limit = limit;
+                    transfer->parser.reset();
+                    transfer->decodedBytes = 0;
+                    transfer->response.clear();
+                    transfer->curl = nullptr;
+                    releaseHandle(curl);
                 }
             }
+
+            if (!transfers.empty())
+            {
+                curl_multi_poll(m_multi, nullptr, 0, 1000, nullptr);
+            }
         }
+    }
 
-        curl_easy_cleanup(curl);
+    catch (...)
+    {
+        for (auto &t : transfers)
+        {
+            if (t.curl)
+            {
+                curl_multi_remove_handle(m_multi, t.curl);
+                releaseHandle(t.curl);
+            }
+        }
+
+        throw;
+    }
+}
+
+void ServerManager::startTransfer(PageTransfer &transfer, const std::string &sparqlQuery) const
+{
+    CURL *curl = acquireHandle();
+    transfer.curl = curl;
+
+    if (m_recorder)
+    {
+        transfer.recording = true;
+        transfer.query = sparqlQuery;
+    }
+
+    if (m_parameters.getServerQueryMethod() == POST)
+    {
+        // The query is sent as the request body: no escaping and no limit on its length
+        curl_easy_setopt(curl, CURLOPT_URL, m_urlPrefix.c_str());
+        curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, static_cast<long>(sparqlQuery.size()));
+        curl_easy_setopt(curl, CURLOPT_COPYPOSTFIELDS, sparqlQuery.c_str());
+    }
+
+    else
+    {
+        std::string url = m_urlPrefix + "&" + escapeUrl(curl, m_parameters.getServerQueryAttribute()) + "="
+                + escapeUrl(curl, sparqlQuery);
+        curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
     }
 
-    return jsonTree;
+    // Set up content receiver
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &transfer);
+    curl_easy_setopt(curl, CURLOPT_PRIVATE, &transfer);
+
+    curl_multi_add_handle(m_multi, curl);
 }
 
-int ServerManager::queryCountElements(const std::string& whereClause) const
+CURL* ServerManager::acquireHandle() const
 {
-    boost::property_tree::ptree jsonTree = query("SELECT COUNT(DISTINCT ?e) as ?count WHERE { " + whereClause + " } ");
-    boost::property_tree::ptree::value_type &binding = *jsonTree.get_child("results.bindings").begin();
-    return binding.second.get<int>("count.value");
+    if (!m_handlesPool.empty())
+    {
+        CURL *curl = m_handlesPool.back();
+        m_handlesPool.pop_back();
+        return curl;
+    }
+
+    CURL *curl = curl_easy_init();
+    if (!curl)
+    {
+        m_logger.critical("Error while initializing CURL handle");
+        std::exit(-1);
+    }
+
+    // Set up timeout
+    curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, m_parameters.getServerTimeout());
+
+    // Set up authentication (if needed)
+    if (!m_parameters.getServerUsername().empty() && !m_parameters.getServerPassword().empty())
+    {
+        std::string authentication = m_parameters.getServerUsername() + ":" + m_parameters.getServerPassword();
+        curl_easy_setopt(curl, CURLOPT_USERPWD, authentication.c_str());
+    }
+
+    // Keep connections alive and, if enabled, multiplex transfers on HTTP/2 connections
+    curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
+    if (m_parameters.isServerHttp2())
+    {
+        curl_easy_setopt(curl, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+        curl_easy_setopt(curl, CURLOPT_PIPEWAIT, 1L);
+    }
+
+    if (m_headers)
+    {
+        curl_easy_setopt(curl, CURLOPT_HTTPHEADER, m_headers);
+    }
+
+    // Advertise every encoding supported by libcurl (gzip, deflate, br, zstd): responses are decompressed as they
+    // arrive, before being given to the write callback
+    if (m_parameters.isServerCompression())
+    {
+        curl_easy_setopt(curl, CURLOPT_ACCEPT_ENCODING, "");
+    }
+
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, queryCallback);
+
+    return curl;
 }
 
-int ServerManager::queryCountTwoElements(const std::string &whereClause) const
+void ServerManager::releaseHandle(CURL *curl) const
 {
-    boost::property_tree::ptree jsonTree = query("SELECT COUNT(*) as ?count WHERE { "
-                                                 "SELECT DISTINCT ?e1 ?e2 WHERE { " + whereClause + " }}");
-    boost::property_tree::ptree::value_type &binding = *(jsonTree.get_child("results.bindings").begin());
-    return binding.second.get<int>("count.value");
+    m_handlesPool.push_back(curl);
 }
 
-std::set<std::string> ServerManager::queryElements(const std::string &whereClause) const
+TransferStatus ServerManager::completeTransfer(PageTransfer &transfer, CURLcode result) const
 {
-    std::set<std::string> elements;
-    auto elementsCount = static_cast<unsigned int>(queryCountElements(whereClause));
+    // Failure of the row handler, the transfer was aborted
+    if (transfer.error)
+    {
+        std::rethrow_exception(transfer.error);
+    }
 
-    while (elements.size() != elementsCount)
+    // Check potential errors (transient, the page can be tried again)
+    if (result != CURLE_OK)
     {
-        elements.clear();
-        unsigned int offset(0);
-        boost::progress_display progressBar(elementsCount);
+        m_logger.error("CURL error " + std::string(curl_easy_strerror(result)));
+        return TRANSFER_FAILED;
+    }
 
-        while (offset <= elementsCount)
-        {
-            std::ostringstream queryStream;
-            queryStream << "SELECT DISTINCT ?e WHERE { " << whereClause << " } ";
-            queryStream << "LIMIT " << m_parameters.getServerMaxRows() << " OFFSET " << offset;
-            boost::property_tree::ptree jsonTree = query(queryStream.str());
+    // Check HTTP status code
+    long httpCode(0);
+    CURLcode res = curl_easy_getinfo(transfer.curl, CURLINFO_RESPONSE_CODE, &httpCode);
 
-            for (boost::property_tree::ptree::value_type &binding : jsonTree.get_child("results.bindings"))
-            {
-                elements.insert(binding.second.get<std::string>("e.value"));
-                ++progressBar;
-            }
+    if (res != CURLE_OK)
+    {
+        std::string message("CURL error " + std::string(curl_easy_strerror(res)));
+        m_logger.critical(message);
+        throw QueryFailed(message);
+    }
 
-            offset += m_parameters.getServerMaxRows();
+    if (httpCode / 100 == 2) // 2xx codes
+    {
+        // Empty body
+        if (!transfer.parser)
+        {
+            createParser(&transfer);
         }
 
-        if (elements.size() != elementsCount)
+        transfer.parser->finish();
+        if (!transfer.parser->isComplete())
         {
-            std::cerr << "Number of elements different from count, retry..." << std::endl;
+            m_logger.error("Malformed response from triplestore: " + transfer.parser->getError());
+            return TRANSFER_FAILED;
         }
+
+        return TRANSFER_DONE;
     }
 
-    return elements;
+    if (httpCode / 100 == 3) // 3xx codes
+    {
+        char *location(nullptr);
+        res = curl_easy_getinfo(transfer.curl, CURLINFO_REDIRECT_URL, &location);
+
+        if (res != CURLE_OK || !location)
+        {
+            std::string message("CURL error " + std::string(curl_easy_strerror(res)));
+            m_logger.critical(message);
+            throw QueryFailed(message);
+        }
+
+        curl_easy_setopt(transfer.curl, CURLOPT_URL, location);
+        return TRANSFER_REDIRECTED;
+    }
+
+    if (httpCode == 404 || httpCode / 100 == 5) // 404 and 5xx codes
+    {
+        m_logger.error("HTTP error while querying triplestore " + std::to_string(httpCode));
+        return TRANSFER_FAILED;
+    }
+
+    std::string message("HTTP error while querying triplestore " + std::to_string(httpCode));
+    m_logger.critical(message);
+    throw QueryFailed(message);
 }
 
-std::set<std::pair<std::string, std::string>> ServerManager::queryTwoElements(const std::string &whereClause) const
+void ServerManager::reportStatistics(const Logger &logger) const
 {
-    std::set<std::pair<std::string, std::string>> elements;
-    auto elementsCount = static_cast<unsigned int>(queryCountTwoElements(whereClause));
+    logger.info(m_telemetry.toString());
 
-    while (elements.size() != elementsCount)
+    if (!m_parameters.getTelemetryReport().empty())
     {
-        elements.clear();
-        unsigned int offset(0);
-        boost::progress_display progressBar(elementsCount);
+        m_telemetry.writeReport(m_parameters.getTelemetryReport(), logger);
+    }
+}
 
-        while (offset <= elementsCount)
-        {
-            std::ostringstream queryStream;
-            queryStream << "SELECT DISTINCT ?e1 ?e2 WHERE { " << whereClause << " } ";
-            queryStream << "LIMIT " << m_parameters.getServerMaxRows() << " OFFSET " << offset;
-            boost::property_tree::ptree jsonTree = query(queryStream.str());
+std::string ServerManager::getFormatValue() const
+{
+    if (m_parameters.getServerResultFormat() == TSV_RESULTS)
+        return "text/tab-separated-values";
 
-            for (boost::property_tree::ptree::value_type &binding : jsonTree.get_child("results.bindings"))
-            {
-                elements.insert(std::pair<std::string, std::string>(
-                        binding.second.get<std::string>("e1.value"),
-                        binding.second.get<std::string>("e2.value"))
-                        );
-                ++progressBar;
-            }
+    if (m_parameters.getServerResultFormat() == CSV_RESULTS)
+        return "text/csv";
+
+    return m_parameters.getServerJsonValue();
+}
+
+std::string ServerManager::keysetFilter(const std::vector<std::string> &variables, const std::vector<std::string> &lastKey)
+{
+    // Lexicographic comparison of (STR(?v1), ..., STR(?vn)) with the last key received
+    std::string filter;
+
+    for (unsigned long i = 0; i < variables.size(); i++)
+    {
+        if (i != 0)
+        {
+            filter += " || ";
+        }
 
-            offset += m_parameters.getServerMaxRows();
+        filter += "(";
+        for (unsigned long j = 0; j < i; j++)
+        {
+            filter += "STR(?" + variables[j] + ") = " + escapeLiteral(lastKey[j]) + " && ";
         }
 
-        if (elements.size() != elementsCount)
+        filter += "STR(?" + variables[i] + ") > " + escapeLiteral(lastKey[i]) + ")";
+    }
+
+    return filter;
+}
+
+std::string ServerManager::escapeLiteral(const std::string &value)
+{
+    std::string literal("\"");
+
+    for (const auto &c : value)
+    {
+        switch (c)
         {
-            std::cerr << "Number of elements different from count, retry..." << std::endl;
+            case '\\':
+                literal += "\\\\";
+                break;
+
+            case '"':
+                literal += "\\\"";
+                break;
+
+            case '\n':
+                literal += "\\n";
+                break;
+
+            case '\r':
+                literal += "\\r";
+                break;
+
+            case '\t':
+                literal += "\\t";
+                break;
+
+            default:
+                literal += c;
         }
     }
 
-    return elements;
+    literal += "\"";
+    return literal;
 }
 
 std::string ServerManager::escapeUrl(CURL *curl, std::string const &url)
@@ -228,8 +799,48 @@ std::string ServerManager::escapeUrl(CURL *curl, std::string const &url)
     return escapedUrl;
 }
 
-size_t queryCallback(char *ptr, size_t size, size_t nmemb, std::string *queryResponse)
+void createParser(PageTransfer *transfer)
 {
-    *queryResponse += std::string(ptr);
-    return nmemb;
+    char *contentType(nullptr);
+    curl_easy_getinfo(transfer->curl, CURLINFO_CONTENT_TYPE, &contentType);
+
+    transfer->parser.reset(ResultsParser::fromContentType(contentType ? contentType : "", *transfer->variables,
+                                                          *transfer->rowHandler));
+}
+
+size_t queryCallback(char *ptr, size_t size, size_t nmemb, PageTransfer *transfer)
+{
+    // Only successful responses are parsed, the bodies of errors and redirections are ignored
+    long httpCode(0);
+    curl_easy_getinfo(transfer->curl, CURLINFO_RESPONSE_CODE, &httpCode);
+
+    if (httpCode / 100 == 2)
+    {
+        if (!transfer->parser)
+        {
+            createParser(transfer);
+        }
+
+        // Exceptions of the row handler must not go through curl: the transfer is aborted and the exception is
+        // rethrown when it completes
+        try
+        {
+            transfer->parser->feed(ptr, size * nmemb);
+        }
+
+        catch (...)
+        {
+            transfer->error = std::current_exception();
+            return 0;
+        }
+
+        transfer->decodedBytes += size * nmemb;
+
+        if (transfer->recording)
+        {
+            transfer->response.append(ptr, size * nmemb);
+        }
+    }
+
+    return size * nmemb;
 }
@@ -2,34 +2,112 @@
 #define TCN3R_SERVERMANAGER_H
 
 
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
 #include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
-#include <boost/property_tree/ptree.hpp>
 #include <curl/curl.h>
 
 #include "../configuration/Configuration.h"
 #include "../io/Logger.h"
+#include "PagingController.h"
+#include "QueryRecorder.h"
+#include "QueryTelemetry.h"
+#include "ResultsParser.h"
+#include "TriplestoreManager.h"
 
-class ServerManager
+// Query of the page of given offset and limit, and handler of a page received (limit and number of rows received)
+// returning whether later pages are needed
+typedef std::function<std::string(unsigned long, unsigned long)> PageQuery;
+typedef std::function<bool(unsigned long, unsigned long)> PageHandler;
+
+enum TransferStatus {
+    TRANSFER_DONE,
+    TRANSFER_REDIRECTED,
+    TRANSFER_FAILED
+};
+
+struct PageTransfer
+{
+    unsigned long offset = 0;
+    unsigned long limit = 0;
+    int tries = 0;
+    unsigned long decodedBytes = 0;
+    const std::vector<std::string> *variables = nullptr;
+    const RowHandler *rowHandler = nullptr;
+
+    // Query sent and body received, kept only when responses are recorded
+    bool recording = false;
+    std::string query;
+    std::string response;
+
+    // Created on the first chunk of the response, according to its content type
+    std::unique_ptr<ResultsParser> parser;
+    CURL *curl = nullptr;
+
+    // Exception of the row handler, raised while receiving the response
+    std::exception_ptr error;
+};
+
+class ServerManager : public TriplestoreManager
 {
     public:
         explicit ServerManager(Configuration const &parameters, Logger const &logger);
-        boost::property_tree::ptree query(std::string const &sparqlQuery) const;
+        ServerManager(const ServerManager&) = delete;
+        ServerManager& operator=(const ServerManager&) = delete;
+        virtual ~ServerManager();
+        void query(std::string const &sparqlQuery, const std::vector<std::string> &variables, const RowHandler &rowHandler) const;
         int queryCountElements(const std::string &whereClause) const;
         int queryCountTwoElements(const std::string &whereClause) const;
-        std::set<std::string> queryElements(const std::string &whereClause) const;
-        std::set<std::pair<std::string, std::string>> queryTwoElements(const std::string &whereClause) const;
+        virtual std::set<std::string> queryElements(const std::string &whereClause) const;
+        virtual std::set<std::pair<std::string, std::string>> queryTwoElements(const std::string &whereClause) const;
+        virtual void queryRows(const std::vector<std::string> &variables, const std::string &whereClause,
+                               const RowHandler &rowHandler) const;
+        virtual void reportStatistics(const Logger &logger) const;
 
     private:
+        int queryCountRows(const std::vector<std::string> &variables, const std::string &whereClause) const;
+        void queryOrderedElements(const std::vector<std::string> &variables, const std::string &whereClause,
+                                  const RowHandler &rowHandler) const;
+        std::string orderedPageQuery(const std::vector<std::string> &variables, const std::string &whereClause,
+                                     const std::vector<std::string> &lastKey, unsigned long offset, unsigned long limit) const;
+        void queryPages(const std::vector<std::string> &variables, const PageQuery &pageQuery, unsigned long rowsCount,
+                        bool splitPages, const RowHandler &rowHandler, const PageHandler &pageHandler) const;
+        void startTransfer(PageTransfer &transfer, const std::string &sparqlQuery) const;
+        CURL* acquireHandle() const;
+        void releaseHandle(CURL *curl) const;
+        TransferStatus completeTransfer(PageTransfer &transfer, CURLcode result) const;
+        std::string getFormatValue() const;
+        static std::pair<std::uint64_t, std::uint64_t> hashRow(const std::vector<std::string> &row);
+        static std::string keysetFilter(const std::vector<std::string> &variables, const std::vector<std::string> &lastKey);
+        static std::string escapeLiteral(const std::string &value);
         static std::string escapeUrl(CURL *curl, std::string const &url);
 
         Configuration const &m_parameters;
         Logger const &m_logger;
+
+        // Connection cache and pool of reusable easy handles
+        CURLM *m_multi;
+        mutable std::vector<CURL*> m_handlesPool;
+        curl_slist *m_headers;
+        std::string m_urlPrefix;
+
+        // Size of pages and number of pages in flight, adapted to the latency and errors of the endpoint
+        mutable PagingController m_pagingController;
+
+        mutable QueryTelemetry m_telemetry;
+
+        // Recorder of query/response pairs, if enabled
+        std::unique_ptr<QueryRecorder> m_recorder;
 };
 
-size_t queryCallback(char *ptr, size_t size, size_t nmemb, std::string *queryResponse);
+void createParser(PageTransfer *transfer);
+size_t queryCallback(char *ptr, size_t size, size_t nmemb, PageTransfer *transfer);
 
 
 #endif //TCN3R_SERVERMANAGER_H
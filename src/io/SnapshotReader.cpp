@@ -0,0 +1,160 @@
+#include <cstdint>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "SnapshotReader.h"
+
+
+SnapshotReader::SnapshotReader(const std::string &path, Logger const &logger) : m_logger(logger), m_data(nullptr),
+                                                                               m_size(0), m_current(nullptr),
+                                                                               m_bodyEnd(nullptr), m_strings()
+{
+    int file = open(path.c_str(), O_RDONLY);
+    struct stat fileStatus{};
+    if (file < 0 || fstat(file, &fileStatus) != 0)
+    {
+        logger.critical("Not possible to open snapshot file: " + path);
+        std::exit(-1);
+    }
+
+    m_size = static_cast<size_t>(fileStatus.st_size);
+    void *data = (m_size > 0) ? mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, file, 0) : MAP_FAILED;
+    close(file);
+
+    if (data == MAP_FAILED)
+    {
+        logger.critical("Not possible to map snapshot file: " + path);
+        std::exit(-1);
+    }
+
+    m_data = static_cast<const char*>(data);
+
+    // Header
+    size_t magicLength = std::strlen(SNAPSHOT_MAGIC);
+    size_t headerLength = magicLength + 2 * sizeof(std::uint32_t) + sizeof(std::uint64_t);
+    if (m_size < headerLength || std::memcmp(m_data, SNAPSHOT_MAGIC, magicLength) != 0)
+    {
+        logger.critical("Not a snapshot file: " + path);
+        std::exit(-1);
+    }
+
+    std::uint32_t version, byteOrder;
+    std::uint64_t tableOffset;
+    std::memcpy(&version, m_data + magicLength, sizeof(version));
+    std::memcpy(&byteOrder, m_data + magicLength + sizeof(version), sizeof(byteOrder));
+    std::memcpy(&tableOffset, m_data + magicLength + 2 * sizeof(std::uint32_t), sizeof(tableOffset));
+
+    if (version != SNAPSHOT_VERSION || byteOrder != SNAPSHOT_BYTE_ORDER)
+    {
+        logger.critical("Snapshot file " + path + " was written by another version of tcn3r or on another architecture,"
+                        " run the ingest phase again");
+        std::exit(-1);
+    }
+
+    if (tableOffset < headerLength || tableOffset > m_size)
+    {
+        corrupted();
+    }
+
+    m_current = m_data + headerLength;
+    m_bodyEnd = m_data + tableOffset;
+
+    // Strings table
+    const char *table = m_bodyEnd;
+    const char *end = m_data + m_size;
+    std::uint32_t stringsCount;
+    if (end - table < static_cast<long>(sizeof(stringsCount)))
+    {
+        corrupted();
+    }
+
+    std::memcpy(&stringsCount, table, sizeof(stringsCount));
+    table += sizeof(stringsCount);
+    m_strings.reserve(stringsCount);
+
+    for (std::uint32_t i = 0; i < stringsCount; i++)
+    {
+        std::uint32_t length;
+        if (end - table < static_cast<long>(sizeof(length)))
+        {
+            corrupted();
+        }
+
+        std::memcpy(&length, table, sizeof(length));
+        table += sizeof(length);
+        if (static_cast<std::uint64_t>(end - table) < length)
+        {
+            corrupted();
+        }
+
+        m_strings.emplace_back(table, length);
+        table += length;
+    }
+}
+
+SnapshotReader::~SnapshotReader()
+{
+    munmap(const_cast<char*>(m_data), m_size);
+}
+
+unsigned int SnapshotReader::readUInt32()
+{
+    std::uint32_t value;
+    if (m_bodyEnd - m_current < static_cast<long>(sizeof(value)))
+    {
+        corrupted();
+    }
+
+    std::memcpy(&value, m_current, sizeof(value));
+    m_current += sizeof(value);
+    return value;
+}
+
+unsigned int SnapshotReader::readIndex(unsigned long count)
+{
+    unsigned int index = readUInt32();
+    if (index >= count)
+    {
+        corrupted();
+    }
+
+    return index;
+}
+
+const std::string& SnapshotReader::readString()
+{
+    unsigned int index = readUInt32();
+    if (index >= m_strings.size())
+    {
+        corrupted();
+    }
+
+    return m_strings[index];
+}
+
+std::set<std::string> SnapshotReader::readStrings()
+{
+    std::set<std::string> values;
+    unsigned int count = readUInt32();
+    for (unsigned int i = 0; i < count; i++)
+    {
+        values.insert(readString());
+    }
+
+    return values;
+}
+
+bool SnapshotReader::isComplete() const
+{
+    return m_current == m_bodyEnd;
+}
+
+void SnapshotReader::corrupted() const
+{
+    m_logger.critical("Corrupted snapshot file");
+    std::exit(-1);
+}
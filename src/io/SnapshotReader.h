@@ -0,0 +1,41 @@
+#ifndef TCN3R_SNAPSHOTREADER_H
+#define TCN3R_SNAPSHOTREADER_H
+
+
+#include <cstddef>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "Logger.h"
+#include "SnapshotWriter.h"
+
+// Reader of a snapshot file written by SnapshotWriter: the file is memory-mapped and values are read in the order
+// they were written
+class SnapshotReader
+{
+    public:
+        SnapshotReader(const std::string &path, Logger const &logger);
+        SnapshotReader(const SnapshotReader&) = delete;
+        SnapshotReader& operator=(const SnapshotReader&) = delete;
+        ~SnapshotReader();
+        unsigned int readUInt32();
+        unsigned int readIndex(unsigned long count);
+        const std::string& readString();
+        std::set<std::string> readStrings();
+        bool isComplete() const;
+
+    private:
+        void corrupted() const;
+
+        Logger const &m_logger;
+
+        const char *m_data;
+        size_t m_size;
+        const char *m_current;
+        const char *m_bodyEnd;
+        std::vector<std::string> m_strings;
+};
+
+
+#endif //TCN3R_SNAPSHOTREADER_H
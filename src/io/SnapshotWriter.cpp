@@ -0,0 +1,72 @@
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+#include "SnapshotWriter.h"
+
+
+SnapshotWriter::SnapshotWriter(std::string path, Logger const &logger) : m_path(std::move(path)), m_logger(logger),
+                                                                        m_body(), m_strings()
+{
+
+}
+
+void SnapshotWriter::writeUInt32(unsigned int value)
+{
+    m_body.push_back(value);
+}
+
+void SnapshotWriter::writeString(const std::string &value)
+{
+    m_body.push_back(m_strings.getElementIndex(value));
+}
+
+void SnapshotWriter::writeStrings(const std::set<std::string> &values)
+{
+    writeUInt32(static_cast<unsigned int>(values.size()));
+    for (const auto &v : values)
+    {
+        writeString(v);
+    }
+}
+
+void SnapshotWriter::close()
+{
+    std::ofstream fileStream(m_path, std::ios::binary | std::ios::trunc);
+    if (!fileStream)
+    {
+        m_logger.critical("Not possible to open snapshot file: " + m_path);
+        std::exit(-1);
+    }
+
+    auto version = static_cast<std::uint32_t>(SNAPSHOT_VERSION);
+    auto byteOrder = static_cast<std::uint32_t>(SNAPSHOT_BYTE_ORDER);
+    auto tableOffset = static_cast<std::uint64_t>(std::strlen(SNAPSHOT_MAGIC) + sizeof(version) + sizeof(byteOrder)
+                                                  + sizeof(std::uint64_t) + m_body.size() * sizeof(std::uint32_t));
+
+    fileStream.write(SNAPSHOT_MAGIC, std::strlen(SNAPSHOT_MAGIC));
+    fileStream.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    fileStream.write(reinterpret_cast<const char*>(&byteOrder), sizeof(byteOrder));
+    fileStream.write(reinterpret_cast<const char*>(&tableOffset), sizeof(tableOffset));
+    fileStream.write(reinterpret_cast<const char*>(m_body.data()), m_body.size() * sizeof(std::uint32_t));
+
+    auto stringsCount = static_cast<std::uint32_t>(m_strings.size());
+    fileStream.write(reinterpret_cast<const char*>(&stringsCount), sizeof(stringsCount));
+    for (unsigned int i = 0; i < m_strings.size(); i++)
+    {
+        std::string value(m_strings.getElementFromIndex(i));
+        auto length = static_cast<std::uint32_t>(value.size());
+        fileStream.write(reinterpret_cast<const char*>(&length), sizeof(length));
+        fileStream.write(value.data(), value.size());
+    }
+
+    if (!fileStream)
+    {
+        m_logger.critical("Error while writing snapshot file: " + m_path);
+        std::exit(-1);
+    }
+
+    m_logger.info("Snapshot written in " + m_path + " (" + std::to_string(m_body.size()) + " values, "
+                  + std::to_string(m_strings.size()) + " strings)");
+}
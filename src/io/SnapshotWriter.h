@@ -0,0 +1,36 @@
+#ifndef TCN3R_SNAPSHOTWRITER_H
+#define TCN3R_SNAPSHOTWRITER_H
+
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "CacheManager.h"
+#include "Logger.h"
+
+// Snapshot files: header (magic, version, byte order mark, offset of the strings table), body of 32-bit values in the
+// order written, then table of the interned strings referenced by the body
+#define SNAPSHOT_MAGIC "TCN3RSNP"
+#define SNAPSHOT_VERSION 2
+#define SNAPSHOT_BYTE_ORDER 0x01020304
+
+class SnapshotWriter
+{
+    public:
+        SnapshotWriter(std::string path, Logger const &logger);
+        void writeUInt32(unsigned int value);
+        void writeString(const std::string &value);
+        void writeStrings(const std::set<std::string> &values);
+        void close();
+
+    private:
+        const std::string m_path;
+        Logger const &m_logger;
+
+        std::vector<unsigned int> m_body;
+        CacheManager m_strings;
+};
+
+
+#endif //TCN3R_SNAPSHOTWRITER_H
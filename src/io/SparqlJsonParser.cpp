@@ -0,0 +1,382 @@
+#include <utility>
+
+#include "SparqlJsonParser.h"
+
+
+SparqlJsonParser::SparqlJsonParser(std::vector<std::string> variables, RowHandler rowHandler) :
+        ResultsParser(std::move(variables), std::move(rowHandler)), m_state(JSON_EXPECT_VALUE), m_inKey(false),
+        m_token(), m_codeUnit(0), m_codeUnitDigits(0), m_highSurrogate(0), m_containers(), m_keys(),
+        m_inBinding(false), m_currentVariable(-1), m_bound(m_variables.size(), false)
+{
+
+}
+
+SparqlJsonParser::~SparqlJsonParser()
+= default;
+
+void SparqlJsonParser::feed(const char *data, size_t size)
+{
+    size_t i(0);
+
+    while (i < size && m_state != JSON_ERROR)
+    {
+        char c = data[i];
+
+        switch (m_state)
+        {
+            case JSON_IN_STRING:
+            {
+                // Copy the longest run of plain characters at once
+                size_t j(i);
+                while (j < size && data[j] != '"' && data[j] != '\\')
+                {
+                    j++;
+                }
+
+                if (m_highSurrogate != 0 && j != i)
+                {
+                    appendUtf8(m_token, m_highSurrogate);
+                    m_highSurrogate = 0;
+                }
+
+                m_token.append(data + i, j - i);
+                i = j;
+
+                if (i < size)
+                {
+                    if (data[i] == '"')
+                    {
+                        endString();
+                    }
+
+                    else
+                    {
+                        m_state = JSON_IN_ESCAPE;
+                    }
+
+                    i++;
+                }
+
+                continue;
+            }
+
+            case JSON_IN_ESCAPE:
+            {
+                if (c == 'u')
+                {
+                    m_codeUnit = 0;
+                    m_codeUnitDigits = 0;
+                    m_state = JSON_IN_UNICODE;
+                    break;
+                }
+
+                if (m_highSurrogate != 0)
+                {
+                    appendUtf8(m_token, m_highSurrogate);
+                    m_highSurrogate = 0;
+                }
+
+                m_state = JSON_IN_STRING;
+                switch (c)
+                {
+                    case '"':
+                    case '\\':
+                    case '/':
+                        m_token += c;
+                        break;
+
+                    case 'b':
+                        m_token += '\b';
+                        break;
+
+                    case 'f':
+                        m_token += '\f';
+                        break;
+
+                    case 'n':
+                        m_token += '\n';
+                        break;
+
+                    case 'r':
+                        m_token += '\r';
+                        break;
+
+                    case 't':
+                        m_token += '\t';
+                        break;
+
+                    default:
+                        fail("invalid escape sequence");
+                }
+
+                break;
+            }
+
+            case JSON_IN_UNICODE:
+            {
+                unsigned long digit;
+                if (c >= '0' && c <= '9')
+                    digit = static_cast<unsigned long>(c - '0');
+                else if (c >= 'a' && c <= 'f')
+                    digit = static_cast<unsigned long>(c - 'a' + 10);
+                else if (c >= 'A' && c <= 'F')
+                    digit = static_cast<unsigned long>(c - 'A' + 10);
+                else
+                {
+                    fail("invalid unicode escape sequence");
+                    break;
+                }
+
+                m_codeUnit = m_codeUnit * 16 + digit;
+                m_codeUnitDigits++;
+
+                if (m_codeUnitDigits == 4)
+                {
+                    m_state = JSON_IN_STRING;
+
+                    if (m_codeUnit >= 0xD800 && m_codeUnit <= 0xDBFF)
+                    {
+                        if (m_highSurrogate != 0)
+                        {
+                            appendUtf8(m_token, m_highSurrogate);
+                        }
+
+                        m_highSurrogate = m_codeUnit;
+                    }
+
+                    else if (m_codeUnit >= 0xDC00 && m_codeUnit <= 0xDFFF && m_highSurrogate != 0)
+                    {
+                        appendUtf8(m_token, 0x10000 + ((m_highSurrogate - 0xD800) << 10) + (m_codeUnit - 0xDC00));
+                        m_highSurrogate = 0;
+                    }
+
+                    else
+                    {
+                        if (m_highSurrogate != 0)
+                        {
+                            appendUtf8(m_token, m_highSurrogate);
+                            m_highSurrogate = 0;
+                        }
+
+                        appendUtf8(m_token, m_codeUnit);
+                    }
+                }
+
+                break;
+            }
+
+            case JSON_IN_SCALAR:
+            {
+                if ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '+' || c == '-' || c == '.')
+                {
+                    m_token += c;
+                    break;
+                }
+
+                // The character ending the scalar is handled in the next state
+                endScalar();
+                continue;
+            }
+
+            default:
+            {
+                if (c == ' ' || c == '\t' || c == '\n' || c == '\r')
+                {
+                    break;
+                }
+
+                if (m_state == JSON_EXPECT_VALUE || m_state == JSON_EXPECT_VALUE_OR_END)
+                {
+                    if (c == '{' || c == '[')
+                    {
+                        startContainer(c);
+                    }
+
+                    else if (c == ']' && m_state == JSON_EXPECT_VALUE_OR_END)
+                    {
+                        endContainer('[');
+                    }
+
+                    else if (c == '"')
+                    {
+                        m_inKey = false;
+                        m_token.clear();
+                        m_state = JSON_IN_STRING;
+                    }
+
+                    else if (c == '-' || (c >= '0' && c <= '9') || c == 't' || c == 'f' || c == 'n')
+                    {
+                        m_token.assign(1, c);
+                        m_state = JSON_IN_SCALAR;
+                    }
+
+                    else
+                    {
+                        fail(std::string("unexpected character '") + c + "'");
+                    }
+                }
+
+                else if (m_state == JSON_EXPECT_KEY || m_state == JSON_EXPECT_KEY_OR_END)
+                {
+                    if (c == '"')
+                    {
+                        m_inKey = true;
+                        m_token.clear();
+                        m_state = JSON_IN_STRING;
+                    }
+
+                    else if (c == '}' && m_state == JSON_EXPECT_KEY_OR_END)
+                    {
+                        endContainer('{');
+                    }
+
+                    else
+                    {
+                        fail(std::string("unexpected character '") + c + "', expected a key");
+                    }
+                }
+
+                else if (m_state == JSON_EXPECT_COLON)
+                {
+                    if (c == ':')
+                        m_state = JSON_EXPECT_VALUE;
+                    else
+                        fail(std::string("unexpected character '") + c + "', expected ':'");
+                }
+
+                else if (m_state == JSON_EXPECT_COMMA_OR_END)
+                {
+                    if (c == ',')
+                        m_state = (m_containers.back() == '{') ? JSON_EXPECT_KEY : JSON_EXPECT_VALUE;
+                    else if (c == '}' || c == ']')
+                        endContainer((c == '}') ? '{' : '[');
+                    else
+                        fail(std::string("unexpected character '") + c + "', expected ',' or end of container");
+                }
+
+                else
+                {
+                    fail(std::string("unexpected character '") + c + "' after the end of the document");
+                }
+            }
+        }
+
+        i++;
+    }
+}
+
+bool SparqlJsonParser::isComplete() const
+{
+    return m_state == JSON_DONE;
+}
+
+void SparqlJsonParser::startContainer(char container)
+{
+    m_containers.push_back(container);
+    m_keys.resize(m_containers.size());
+
+    // Binding: results.bindings[i]
+    if (container == '{' && m_containers.size() == 4 && m_containers[2] == '[' && m_keys[0] == "results" && m_keys[1] == "bindings")
+    {
+        m_inBinding = true;
+        m_bound.assign(m_variables.size(), false);
+    }
+
+    // Bound term: results.bindings[i].variable
+    else if (container == '{' && m_containers.size() == 5 && m_inBinding)
+    {
+        m_currentVariable = -1;
+
+        for (unsigned long v = 0; v < m_variables.size(); v++)
+        {
+            if (m_variables[v] == m_keys[3])
+            {
+                m_currentVariable = static_cast<int>(v);
+            }
+        }
+    }
+
+    m_state = (container == '{') ? JSON_EXPECT_KEY_OR_END : JSON_EXPECT_VALUE_OR_END;
+}
+
+void SparqlJsonParser::endContainer(char container)
+{
+    if (m_containers.empty() || m_containers.back() != container)
+    {
+        fail("unbalanced containers");
+        return;
+    }
+
+    if (m_containers.size() == 4 && m_inBinding)
+    {
+        m_inBinding = false;
+
+        for (unsigned long v = 0; v < m_variables.size(); v++)
+        {
+            if (!m_bound[v])
+            {
+                fail("variable " + m_variables[v] + " not bound in a result");
+                return;
+            }
+        }
+
+        emitRow();
+    }
+
+    else if (m_containers.size() == 5)
+    {
+        m_currentVariable = -1;
+    }
+
+    m_containers.pop_back();
+    m_keys.pop_back();
+    endValue();
+}
+
+void SparqlJsonParser::endString()
+{
+    if (m_highSurrogate != 0)
+    {
+        appendUtf8(m_token, m_highSurrogate);
+        m_highSurrogate = 0;
+    }
+
+    if (m_inKey)
+    {
+        m_keys.back().swap(m_token);
+        m_state = JSON_EXPECT_COLON;
+    }
+
+    else
+    {
+        setValue(m_token);
+        endValue();
+    }
+}
+
+void SparqlJsonParser::endScalar()
+{
+    setValue(m_token);
+    endValue();
+}
+
+void SparqlJsonParser::endValue()
+{
+    m_state = m_containers.empty() ? JSON_DONE : JSON_EXPECT_COMMA_OR_END;
+}
+
+void SparqlJsonParser::setValue(std::string &value)
+{
+    // Value of a bound term: results.bindings[i].variable.value
+    if (m_currentVariable >= 0 && m_containers.size() == 5 && m_keys[4] == "value")
+    {
+        m_row[m_currentVariable].swap(value);
+        m_bound[m_currentVariable] = true;
+    }
+}
+
+void SparqlJsonParser::fail(const std::string &error)
+{
+    m_state = JSON_ERROR;
+    m_error = error;
+}
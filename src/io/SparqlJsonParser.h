@@ -0,0 +1,62 @@
+#ifndef TCN3R_SPARQLJSONPARSER_H
+#define TCN3R_SPARQLJSONPARSER_H
+
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "ResultsParser.h"
+
+enum JsonParserState {
+    JSON_EXPECT_VALUE,
+    JSON_EXPECT_VALUE_OR_END,
+    JSON_EXPECT_KEY,
+    JSON_EXPECT_KEY_OR_END,
+    JSON_EXPECT_COLON,
+    JSON_EXPECT_COMMA_OR_END,
+    JSON_IN_STRING,
+    JSON_IN_ESCAPE,
+    JSON_IN_UNICODE,
+    JSON_IN_SCALAR,
+    JSON_DONE,
+    JSON_ERROR
+};
+
+// Incremental parser of SPARQL results in JSON (application/sparql-results+json)
+// Each binding of results.bindings is given to the row handler as soon as it is complete: no document tree is built
+class SparqlJsonParser : public ResultsParser
+{
+    public:
+        SparqlJsonParser(std::vector<std::string> variables, RowHandler rowHandler);
+        virtual ~SparqlJsonParser();
+        virtual void feed(const char *data, size_t size);
+        virtual bool isComplete() const;
+
+    private:
+        void startContainer(char container);
+        void endContainer(char container);
+        void endString();
+        void endScalar();
+        void endValue();
+        void setValue(std::string &value);
+        void fail(const std::string &error);
+
+        JsonParserState m_state;
+        bool m_inKey;
+        std::string m_token;
+        unsigned long m_codeUnit;
+        int m_codeUnitDigits;
+        unsigned long m_highSurrogate;
+
+        // Containers ('{' or '[') from the root and current key of each object
+        std::vector<char> m_containers;
+        std::vector<std::string> m_keys;
+
+        bool m_inBinding;
+        int m_currentVariable;
+        std::vector<bool> m_bound;
+};
+
+
+#endif //TCN3R_SPARQLJSONPARSER_H
@@ -0,0 +1,340 @@
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "SparqlSeparatedValuesParser.h"
+
+
+SparqlSeparatedValuesParser::SparqlSeparatedValuesParser(ResultFormat format, std::vector<std::string> variables,
+                                                         RowHandler rowHandler) :
+        ResultsParser(std::move(variables), std::move(rowHandler)), m_format(format),
+        m_separator((format == CSV_RESULTS) ? ',' : '\t'), m_pending(), m_headerParsed(false), m_headerSize(0),
+        m_finished(false), m_fields(), m_columns(m_variables.size(), 0)
+{
+
+}
+
+SparqlSeparatedValuesParser::~SparqlSeparatedValuesParser()
+= default;
+
+void SparqlSeparatedValuesParser::feed(const char *data, size_t size)
+{
+    const char *current = data;
+    const char *end = data + size;
+
+    while (current < end && m_error.empty())
+    {
+        auto newLine = static_cast<const char*>(std::memchr(current, '\n', end - current));
+
+        if (newLine == nullptr)
+        {
+            m_pending.append(current, end);
+            return;
+        }
+
+        // End of a line started in a previous chunk
+        if (!m_pending.empty())
+        {
+            m_pending.append(current, newLine);
+
+            if (isRecordComplete(m_pending.data(), m_pending.data() + m_pending.size()))
+            {
+                parseLine(m_pending.data(), m_pending.data() + m_pending.size());
+                m_pending.clear();
+            }
+
+            else
+            {
+                m_pending += '\n';
+            }
+        }
+
+        else if (isRecordComplete(current, newLine))
+        {
+            parseLine(current, newLine);
+        }
+
+        // CSV value containing a line break
+        else
+        {
+            m_pending.assign(current, newLine);
+            m_pending += '\n';
+        }
+
+        current = newLine + 1;
+    }
+}
+
+void SparqlSeparatedValuesParser::finish()
+{
+    // The last line may not be terminated
+    if (!m_pending.empty() && m_error.empty())
+    {
+        if (isRecordComplete(m_pending.data(), m_pending.data() + m_pending.size()))
+            parseLine(m_pending.data(), m_pending.data() + m_pending.size());
+        else
+            fail("unterminated quoted value");
+
+        m_pending.clear();
+    }
+
+    m_finished = true;
+}
+
+bool SparqlSeparatedValuesParser::isComplete() const
+{
+    return m_finished && m_headerParsed && m_error.empty();
+}
+
+void SparqlSeparatedValuesParser::parseLine(const char *begin, const char *end)
+{
+    if (end != begin && *(end - 1) == '\r')
+    {
+        end--;
+    }
+
+    splitFields(begin, end);
+
+    if (!m_headerParsed)
+    {
+        parseHeader();
+        return;
+    }
+
+    if (m_fields.size() != m_headerSize)
+    {
+        fail("wrong number of values in a result");
+        return;
+    }
+
+    for (unsigned long v = 0; v < m_variables.size() && m_error.empty(); v++)
+    {
+        const std::pair<const char*, const char*> &field = m_fields[m_columns[v]];
+
+        if (field.first == field.second)
+        {
+            fail("variable " + m_variables[v] + " not bound in a result");
+            return;
+        }
+
+        decodeField(field.first, field.second, m_row[v]);
+    }
+
+    if (m_error.empty())
+    {
+        emitRow();
+    }
+}
+
+void SparqlSeparatedValuesParser::parseHeader()
+{
+    std::vector<std::string> names(m_fields.size());
+    for (unsigned long i = 0; i < m_fields.size(); i++)
+    {
+        decodeField(m_fields[i].first, m_fields[i].second, names[i]);
+
+        // TSV headers are variables ("?e"), CSV headers are names ("e")
+        if (!names[i].empty() && (names[i][0] == '?' || names[i][0] == '$'))
+        {
+            names[i].erase(0, 1);
+        }
+    }
+
+    for (unsigned long v = 0; v < m_variables.size(); v++)
+    {
+        auto it = std::find(names.begin(), names.end(), m_variables[v]);
+
+        if (it == names.end())
+        {
+            fail("variable " + m_variables[v] + " not in the header of the results");
+            return;
+        }
+
+        m_columns[v] = static_cast<unsigned long>(it - names.begin());
+    }
+
+    m_headerSize = names.size();
+    m_headerParsed = true;
+}
+
+void SparqlSeparatedValuesParser::splitFields(const char *begin, const char *end)
+{
+    m_fields.clear();
+
+    const char *fieldBegin = begin;
+    bool inQuotes = false;
+
+    for (const char *c = begin; c < end; c++)
+    {
+        if (m_format == CSV_RESULTS && *c == '"')
+        {
+            inQuotes = !inQuotes;
+        }
+
+        else if (*c == m_separator && !inQuotes)
+        {
+            m_fields.emplace_back(fieldBegin, c);
+            fieldBegin = c + 1;
+        }
+    }
+
+    m_fields.emplace_back(fieldBegin, end);
+}
+
+void SparqlSeparatedValuesParser::decodeField(const char *begin, const char *end, std::string &value)
+{
+    if (m_format == CSV_RESULTS)
+    {
+        if (end - begin >= 2 && *begin == '"' && *(end - 1) == '"')
+        {
+            value.clear();
+            for (const char *c = begin + 1; c < end - 1; c++)
+            {
+                value += *c;
+
+                // Escaped quote: ""
+                if (*c == '"')
+                {
+                    c++;
+                }
+            }
+        }
+
+        else
+        {
+            value.assign(begin, end);
+        }
+    }
+
+    else if (*begin == '<')
+    {
+        if (*(end - 1) != '>')
+        {
+            fail("unterminated IRI");
+            return;
+        }
+
+        value.assign(begin + 1, end - 1);
+    }
+
+    else if (*begin == '"')
+    {
+        decodeTsvLiteral(begin, end, value);
+    }
+
+    else if (end - begin >= 2 && *begin == '_' && *(begin + 1) == ':')
+    {
+        value.assign(begin + 2, end);
+    }
+
+    // Numbers and booleans may be written without quotes
+    else
+    {
+        value.assign(begin, end);
+    }
+}
+
+void SparqlSeparatedValuesParser::decodeTsvLiteral(const char *begin, const char *end, std::string &value)
+{
+    value.clear();
+
+    // The lexical form ends at the first unescaped quote, any language or datatype after it is ignored
+    for (const char *c = begin + 1; c < end; c++)
+    {
+        const char *plain = c;
+        while (c < end && *c != '"' && *c != '\\')
+        {
+            c++;
+        }
+
+        value.append(plain, c);
+
+        if (c == end)
+        {
+            break;
+        }
+
+        if (*c == '"')
+        {
+            return;
+        }
+
+        c++;
+        if (c == end)
+        {
+            break;
+        }
+
+        switch (*c)
+        {
+            case 't':
+                value += '\t';
+                break;
+
+            case 'b':
+                value += '\b';
+                break;
+
+            case 'n':
+                value += '\n';
+                break;
+
+            case 'r':
+                value += '\r';
+                break;
+
+            case 'f':
+                value += '\f';
+                break;
+
+            case 'u':
+            case 'U':
+            {
+                long digits = (*c == 'u') ? 4 : 8;
+                if (end - c <= digits)
+                {
+                    fail("invalid unicode escape sequence");
+                    return;
+                }
+
+                unsigned long codePoint = 0;
+                for (long d = 1; d <= digits; d++)
+                {
+                    char h = c[d];
+                    if (h >= '0' && h <= '9')
+                        codePoint = codePoint * 16 + static_cast<unsigned long>(h - '0');
+                    else if (h >= 'a' && h <= 'f')
+                        codePoint = codePoint * 16 + static_cast<unsigned long>(h - 'a' + 10);
+                    else if (h >= 'A' && h <= 'F')
+                        codePoint = codePoint * 16 + static_cast<unsigned long>(h - 'A' + 10);
+                    else
+                    {
+                        fail("invalid unicode escape sequence");
+                        return;
+                    }
+                }
+
+                appendUtf8(value, codePoint);
+                c += digits;
+                break;
+            }
+
+            // Quotes and backslashes
+            default:
+                value += *c;
+        }
+    }
+
+    fail("unterminated literal");
+}
+
+bool SparqlSeparatedValuesParser::isRecordComplete(const char *begin, const char *end) const
+{
+    // In CSV, a line break between quotes is part of a value
+    return m_format != CSV_RESULTS || std::count(begin, end, '"') % 2 == 0;
+}
+
+void SparqlSeparatedValuesParser::fail(const std::string &error)
+{
+    m_error = error;
+}
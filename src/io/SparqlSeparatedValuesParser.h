@@ -0,0 +1,51 @@
+#ifndef TCN3R_SPARQLSEPARATEDVALUESPARSER_H
+#define TCN3R_SPARQLSEPARATEDVALUESPARSER_H
+
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../configuration/Configuration.h"
+#include "ResultsParser.h"
+
+// Incremental parser of SPARQL results in TSV (text/tab-separated-values) or CSV (text/csv)
+// Complete lines are tokenized in place in the received chunks: only a line spanning two chunks is copied
+// TSV terms are decoded to their values (IRIs without brackets, literals without quotes, language or datatype, blank
+// nodes without "_:"), CSV values are used as is
+class SparqlSeparatedValuesParser : public ResultsParser
+{
+    public:
+        SparqlSeparatedValuesParser(ResultFormat format, std::vector<std::string> variables, RowHandler rowHandler);
+        virtual ~SparqlSeparatedValuesParser();
+        virtual void feed(const char *data, size_t size);
+        virtual void finish();
+        virtual bool isComplete() const;
+
+    private:
+        void parseLine(const char *begin, const char *end);
+        void parseHeader();
+        void splitFields(const char *begin, const char *end);
+        void decodeField(const char *begin, const char *end, std::string &value);
+        void decodeTsvLiteral(const char *begin, const char *end, std::string &value);
+        bool isRecordComplete(const char *begin, const char *end) const;
+        void fail(const std::string &error);
+
+        const ResultFormat m_format;
+        const char m_separator;
+
+        // Line spanning several chunks
+        std::string m_pending;
+
+        bool m_headerParsed;
+        unsigned long m_headerSize;
+        bool m_finished;
+
+        // Bounds of the fields of the current line and column of each variable
+        std::vector<std::pair<const char*, const char*>> m_fields;
+        std::vector<unsigned long> m_columns;
+};
+
+
+#endif //TCN3R_SPARQLSEPARATEDVALUESPARSER_H
@@ -0,0 +1,75 @@
+#include <algorithm>
+#include <thread>
+#include <utility>
+
+#include "QueryFailed.h"
+#include "RowsQueue.h"
+#include "TriplestoreManager.h"
+
+
+TriplestoreManager::~TriplestoreManager()
+= default;
+
+void TriplestoreManager::reportStatistics(const Logger &logger) const
+{
+
+}
+
+void TriplestoreManager::queryRowsPipelined(const std::vector<std::string> &variables, const std::string &whereClause,
+                                            const RowHandler &rowHandler, unsigned long capacity) const
+{
+    if (capacity == 0)
+    {
+        queryRows(variables, whereClause, rowHandler);
+        return;
+    }
+
+    // Rows are fetched and parsed by a producer thread while the row handler is called in this thread: at most
+    // capacity rows wait between both
+    unsigned long chunkSize = std::min(capacity, static_cast<unsigned long>(ROWS_CHUNK_SIZE));
+    RowsQueue queue(capacity / chunkSize);
+
+    // Failures of the producer (failed queries) are rethrown in this thread by the queue
+    std::thread producer([this, &variables, &whereClause, &queue, chunkSize]() {
+        try
+        {
+            RowsChunk chunk;
+            queryRows(variables, whereClause, [&queue, &chunk, chunkSize](const std::vector<std::string> &row) {
+                chunk.push_back(row);
+
+                if (chunk.size() == chunkSize)
+                {
+                    if (!queue.push(std::move(chunk)))
+                    {
+                        throw QueryFailed("Rows of the query are not consumed anymore");
+                    }
+
+                    chunk = RowsChunk();
+                }
+            });
+
+            if (!chunk.empty())
+            {
+                queue.push(std::move(chunk));
+            }
+
+            queue.close();
+        }
+
+        catch (...)
+        {
+            queue.close(std::current_exception());
+        }
+    });
+
+    RowsProducerGuard producerGuard(queue, producer);
+
+    RowsChunk chunk;
+    while (queue.pop(chunk))
+    {
+        for (const auto &row : chunk)
+        {
+            rowHandler(row);
+        }
+    }
+}
@@ -0,0 +1,34 @@
+#ifndef TCN3R_TRIPLESTOREMANAGER_H
+#define TCN3R_TRIPLESTOREMANAGER_H
+
+
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Logger.h"
+#include "ResultsParser.h"
+
+// Number of rows given at once from the fetching thread to the building thread
+#define ROWS_CHUNK_SIZE 1024
+
+// Source of the triples to reconcile: a SPARQL endpoint (ServerManager) or a local dump (DumpManager)
+// Where clauses are SPARQL basic graph patterns, values of IRIs, literals and blank nodes are given as in SPARQL results
+class TriplestoreManager
+{
+    public:
+        virtual ~TriplestoreManager();
+        virtual std::set<std::string> queryElements(const std::string &whereClause) const = 0;
+        virtual std::set<std::pair<std::string, std::string>> queryTwoElements(const std::string &whereClause) const = 0;
+        // Distinct rows are given to the row handler as they are received, a row may be given again if the query is
+        // fetched again (see pagination): row handlers must ignore duplicates
+        virtual void queryRows(const std::vector<std::string> &variables, const std::string &whereClause,
+                               const RowHandler &rowHandler) const = 0;
+        virtual void reportStatistics(const Logger &logger) const;
+        void queryRowsPipelined(const std::vector<std::string> &variables, const std::string &whereClause,
+                                const RowHandler &rowHandler, unsigned long capacity) const;
+};
+
+
+#endif //TCN3R_TRIPLESTOREMANAGER_H
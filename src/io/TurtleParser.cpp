@@ -0,0 +1,872 @@
+#include <algorithm>
+#include <cctype>
+
+#include "ResultsParser.h"
+#include "TurtleParser.h"
+
+#define RDF_NAMESPACE "http://www.w3.org/1999/02/22-rdf-syntax-ns#"
+
+
+static bool isNameChar(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == '-'
+           || c == '.' || static_cast<unsigned char>(c) >= 0x80;
+}
+
+TurtleParser::TurtleParser(const char *begin, const char *end, CacheManager &terms, std::vector<Triple> &triples) :
+        m_current(begin), m_end(end), m_terms(terms), m_triples(triples), m_prefixes(), m_base(),
+        m_blankNodesCount(0), m_error()
+{
+
+}
+
+bool TurtleParser::parse()
+{
+    skipWhitespace();
+
+    while (m_current < m_end)
+    {
+        bool parsed;
+        if (*m_current == '@' || isKeyword("PREFIX") || isKeyword("BASE"))
+            parsed = parseDirective();
+        else
+            parsed = parseTriples();
+
+        if (!parsed)
+        {
+            return false;
+        }
+
+        skipWhitespace();
+    }
+
+    return true;
+}
+
+std::string TurtleParser::getError() const
+{
+    return m_error;
+}
+
+const char* TurtleParser::getPosition() const
+{
+    return m_current;
+}
+
+bool TurtleParser::parseDirective()
+{
+    // SPARQL style directives (PREFIX, BASE) do not end with '.'
+    bool sparqlStyle(*m_current != '@');
+    bool prefix;
+
+    if (isKeyword("@prefix") || isKeyword("PREFIX"))
+        prefix = true;
+    else if (isKeyword("@base") || isKeyword("BASE"))
+        prefix = false;
+    else
+        return fail("unknown directive");
+
+    m_current += (prefix ? 6 : 4) + (sparqlStyle ? 0 : 1);
+
+    skipWhitespace();
+
+    if (prefix)
+    {
+        const char *name = m_current;
+        while (m_current < m_end && isNameChar(*m_current))
+        {
+            m_current++;
+        }
+
+        std::string prefixName(name, m_current);
+        if (!expect(':'))
+        {
+            return false;
+        }
+
+        skipWhitespace();
+        std::string iri;
+        if (!parseIri(iri))
+        {
+            return false;
+        }
+
+        m_prefixes[prefixName] = iri;
+    }
+
+    else
+    {
+        if (!parseIri(m_base))
+        {
+            return false;
+        }
+    }
+
+    if (!sparqlStyle)
+    {
+        skipWhitespace();
+        return expect('.');
+    }
+
+    return true;
+}
+
+bool TurtleParser::parseTriples()
+{
+    unsigned int subject;
+
+    if (*m_current == '[')
+    {
+        if (!parseBlankNodePropertyList(subject))
+        {
+            return false;
+        }
+
+        // A blank node property list may be a statement on its own
+        skipWhitespace();
+        if (m_current < m_end && *m_current == '.')
+        {
+            m_current++;
+            return true;
+        }
+    }
+
+    else if (!parseTerm(subject, false))
+    {
+        return false;
+    }
+
+    skipWhitespace();
+    if (!parsePredicateObjectList(subject))
+    {
+        return false;
+    }
+
+    skipWhitespace();
+    return expect('.');
+}
+
+bool TurtleParser::parsePredicateObjectList(unsigned int subject)
+{
+    while (true)
+    {
+        unsigned int predicate;
+        if (!parseTerm(predicate, true))
+        {
+            return false;
+        }
+
+        skipWhitespace();
+        if (!parseObjectList(subject, predicate))
+        {
+            return false;
+        }
+
+        skipWhitespace();
+        if (m_current >= m_end || *m_current != ';')
+        {
+            return true;
+        }
+
+        while (m_current < m_end && *m_current == ';')
+        {
+            m_current++;
+            skipWhitespace();
+        }
+
+        if (m_current >= m_end || *m_current == '.' || *m_current == ']')
+        {
+            return true;
+        }
+    }
+}
+
+bool TurtleParser::parseObjectList(unsigned int subject, unsigned int predicate)
+{
+    while (true)
+    {
+        unsigned int object;
+        if (!parseTerm(object, false))
+        {
+            return false;
+        }
+
+        addTriple(subject, predicate, object);
+
+        skipWhitespace();
+        if (m_current >= m_end || *m_current != ',')
+        {
+            return true;
+        }
+
+        m_current++;
+        skipWhitespace();
+    }
+}
+
+bool TurtleParser::parseTerm(unsigned int &term, bool predicate)
+{
+    if (m_current >= m_end)
+    {
+        return fail("unexpected end of document");
+    }
+
+    char c = *m_current;
+    std::string value;
+
+    if (c == '<')
+    {
+        if (!parseIri(value))
+        {
+            return false;
+        }
+
+        term = m_terms.getElementIndex("I" + value);
+        return true;
+    }
+
+    if (predicate)
+    {
+        if (c == 'a' && (m_current + 1 == m_end || (!isNameChar(*(m_current + 1)) && *(m_current + 1) != ':')))
+        {
+            m_current++;
+            term = m_terms.getElementIndex("I" RDF_NAMESPACE "type");
+            return true;
+        }
+    }
+
+    else if (c == '_' && m_current + 1 < m_end && *(m_current + 1) == ':')
+    {
+        if (!parseBlankNodeLabel(value))
+        {
+            return false;
+        }
+
+        term = m_terms.getElementIndex("B" + value);
+        return true;
+    }
+
+    else if (c == '[')
+    {
+        return parseBlankNodePropertyList(term);
+    }
+
+    else if (c == '(')
+    {
+        return parseCollection(term);
+    }
+
+    else if (isKeyword("true") || isKeyword("false"))
+    {
+        value = (c == 't') ? "true" : "false";
+        m_current += value.size();
+
+        term = m_terms.getElementIndex("L" + value);
+        return true;
+    }
+
+    else if (c == '"' || c == '\'' || c == '+' || c == '-' || c == '.' || (c >= '0' && c <= '9'))
+    {
+        if (!parseLiteral(value))
+        {
+            return false;
+        }
+
+        term = m_terms.getElementIndex("L" + value);
+        return true;
+    }
+
+    if (!parsePrefixedName(value))
+    {
+        return false;
+    }
+
+    term = m_terms.getElementIndex("I" + value);
+    return true;
+}
+
+bool TurtleParser::parseIri(std::string &iri)
+{
+    if (!expect('<'))
+    {
+        return false;
+    }
+
+    std::string value;
+    while (m_current < m_end && *m_current != '>')
+    {
+        const char *plain = m_current;
+        while (m_current < m_end && *m_current != '>' && *m_current != '\\')
+        {
+            m_current++;
+        }
+
+        value.append(plain, m_current);
+
+        if (m_current < m_end && *m_current == '\\')
+        {
+            m_current++;
+            if (m_current >= m_end || (*m_current != 'u' && *m_current != 'U'))
+            {
+                return fail("invalid escape sequence in IRI");
+            }
+
+            int digits = (*m_current == 'u') ? 4 : 8;
+            m_current++;
+            if (!parseUnicodeEscape(value, digits))
+            {
+                return false;
+            }
+        }
+    }
+
+    if (!expect('>'))
+    {
+        return false;
+    }
+
+    iri = resolveIri(value);
+    return true;
+}
+
+bool TurtleParser::parsePrefixedName(std::string &iri)
+{
+    const char *name = m_current;
+    while (m_current < m_end && isNameChar(*m_current))
+    {
+        m_current++;
+    }
+
+    std::string prefix(name, m_current);
+    if (m_current >= m_end || *m_current != ':')
+    {
+        return fail("invalid term");
+    }
+
+    m_current++;
+
+    auto it = m_prefixes.find(prefix);
+    if (it == m_prefixes.end())
+    {
+        return fail("undefined prefix " + prefix);
+    }
+
+    // A final '.' ends the statement, it does not belong to the local name
+    std::string local;
+    unsigned long trailingDots(0);
+
+    while (m_current < m_end)
+    {
+        char c = *m_current;
+
+        if (isNameChar(c) || c == ':' || c == '%')
+        {
+            local += c;
+            trailingDots = (c == '.') ? trailingDots + 1 : 0;
+            m_current++;
+        }
+
+        else if (c == '\\' && m_current + 1 < m_end)
+        {
+            local += *(m_current + 1);
+            trailingDots = 0;
+            m_current += 2;
+        }
+
+        else
+        {
+            break;
+        }
+    }
+
+    local.resize(local.size() - trailingDots);
+    m_current -= trailingDots;
+
+    iri = it->second + local;
+    return true;
+}
+
+bool TurtleParser::parseBlankNodeLabel(std::string &label)
+{
+    m_current += 2;
+
+    const char *name = m_current;
+    while (m_current < m_end && isNameChar(*m_current))
+    {
+        m_current++;
+    }
+
+    while (m_current > name && *(m_current - 1) == '.')
+    {
+        m_current--;
+    }
+
+    if (m_current == name)
+    {
+        return fail("empty blank node label");
+    }
+
+    label.assign(name, m_current);
+    return true;
+}
+
+bool TurtleParser::parseBlankNodePropertyList(unsigned int &term)
+{
+    m_current++;
+    skipWhitespace();
+
+    term = newBlankNode();
+    if (m_current < m_end && *m_current == ']')
+    {
+        m_current++;
+        return true;
+    }
+
+    if (!parsePredicateObjectList(term))
+    {
+        return false;
+    }
+
+    skipWhitespace();
+    return expect(']');
+}
+
+bool TurtleParser::parseCollection(unsigned int &term)
+{
+    m_current++;
+    skipWhitespace();
+
+    std::vector<unsigned int> items;
+    while (m_current < m_end && *m_current != ')')
+    {
+        unsigned int item;
+        if (!parseTerm(item, false))
+        {
+            return false;
+        }
+
+        items.push_back(item);
+        skipWhitespace();
+    }
+
+    if (!expect(')'))
+    {
+        return false;
+    }
+
+    unsigned int nil = m_terms.getElementIndex("I" RDF_NAMESPACE "nil");
+    if (items.empty())
+    {
+        term = nil;
+        return true;
+    }
+
+    unsigned int first = m_terms.getElementIndex("I" RDF_NAMESPACE "first");
+    unsigned int rest = m_terms.getElementIndex("I" RDF_NAMESPACE "rest");
+
+    term = newBlankNode();
+    unsigned int node = term;
+    for (unsigned long i = 0; i < items.size(); i++)
+    {
+        unsigned int next = (i + 1 < items.size()) ? newBlankNode() : nil;
+        addTriple(node, first, items[i]);
+        addTriple(node, rest, next);
+        node = next;
+    }
+
+    return true;
+}
+
+bool TurtleParser::parseLiteral(std::string &value)
+{
+    char c = *m_current;
+
+    if (c != '"' && c != '\'')
+    {
+        return parseNumber(value);
+    }
+
+    if (!parseString(value))
+    {
+        return false;
+    }
+
+    if (m_current < m_end && *m_current == '@')
+    {
+        m_current++;
+        while (m_current < m_end && (isNameChar(*m_current) && *m_current != '.' && *m_current != '_'))
+        {
+            m_current++;
+        }
+    }
+
+    else if (m_end - m_current >= 2 && *m_current == '^' && *(m_current + 1) == '^')
+    {
+        m_current += 2;
+
+        std::string datatype;
+        if (m_current < m_end && *m_current == '<')
+            return parseIri(datatype);
+        else
+            return parsePrefixedName(datatype);
+    }
+
+    return true;
+}
+
+bool TurtleParser::parseString(std::string &value)
+{
+    char quote = *m_current;
+    bool longString = (m_end - m_current >= 3 && *(m_current + 1) == quote && *(m_current + 2) == quote);
+    m_current += longString ? 3 : 1;
+
+    while (m_current < m_end)
+    {
+        const char *plain = m_current;
+        while (m_current < m_end && *m_current != quote && *m_current != '\\' && *m_current != '\n' && *m_current != '\r')
+        {
+            m_current++;
+        }
+
+        value.append(plain, m_current);
+
+        if (m_current >= m_end)
+        {
+            break;
+        }
+
+        char c = *m_current;
+
+        if (c == quote)
+        {
+            if (!longString)
+            {
+                m_current++;
+                return true;
+            }
+
+            // The closing delimiter is made of the last three quotes of a sequence
+            if (m_end - m_current >= 3 && *(m_current + 1) == quote && *(m_current + 2) == quote
+                && (m_end - m_current == 3 || *(m_current + 3) != quote))
+            {
+                m_current += 3;
+                return true;
+            }
+
+            value += c;
+            m_current++;
+        }
+
+        else if (c == '\\')
+        {
+            m_current++;
+            if (m_current >= m_end)
+            {
+                break;
+            }
+
+            c = *m_current++;
+            switch (c)
+            {
+                case 't':
+                    value += '\t';
+                    break;
+
+                case 'b':
+                    value += '\b';
+                    break;
+
+                case 'n':
+                    value += '\n';
+                    break;
+
+                case 'r':
+                    value += '\r';
+                    break;
+
+                case 'f':
+                    value += '\f';
+                    break;
+
+                case '"':
+                case '\'':
+                case '\\':
+                    value += c;
+                    break;
+
+                case 'u':
+                case 'U':
+                    if (!parseUnicodeEscape(value, (c == 'u') ? 4 : 8))
+                    {
+                        return false;
+                    }
+                    break;
+
+                default:
+                    return fail("invalid escape sequence in literal");
+            }
+        }
+
+        // Line break
+        else
+        {
+            if (!longString)
+            {
+                return fail("line break in literal");
+            }
+
+            value += c;
+            m_current++;
+        }
+    }
+
+    return fail("unterminated literal");
+}
+
+bool TurtleParser::parseNumber(std::string &value)
+{
+    const char *number = m_current;
+    bool digits(false);
+
+    if (m_current < m_end && (*m_current == '+' || *m_current == '-'))
+    {
+        m_current++;
+    }
+
+    while (m_current < m_end && *m_current >= '0' && *m_current <= '9')
+    {
+        m_current++;
+        digits = true;
+    }
+
+    // A '.' not followed by a digit ends the statement
+    if (m_end - m_current >= 2 && *m_current == '.' && *(m_current + 1) >= '0' && *(m_current + 1) <= '9')
+    {
+        m_current++;
+        while (m_current < m_end && *m_current >= '0' && *m_current <= '9')
+        {
+            m_current++;
+            digits = true;
+        }
+    }
+
+    if (digits && m_current < m_end && (*m_current == 'e' || *m_current == 'E'))
+    {
+        m_current++;
+        if (m_current < m_end && (*m_current == '+' || *m_current == '-'))
+        {
+            m_current++;
+        }
+
+        const char *exponent = m_current;
+        while (m_current < m_end && *m_current >= '0' && *m_current <= '9')
+        {
+            m_current++;
+        }
+
+        digits = (m_current != exponent);
+    }
+
+    if (!digits)
+    {
+        m_current = number;
+        return fail("invalid term");
+    }
+
+    value.assign(number, m_current);
+    return true;
+}
+
+bool TurtleParser::parseUnicodeEscape(std::string &output, int digits)
+{
+    if (m_end - m_current < digits)
+    {
+        return fail("invalid unicode escape sequence");
+    }
+
+    unsigned long codePoint(0);
+    for (int d = 0; d < digits; d++)
+    {
+        char h = *m_current++;
+        if (h >= '0' && h <= '9')
+            codePoint = codePoint * 16 + static_cast<unsigned long>(h - '0');
+        else if (h >= 'a' && h <= 'f')
+            codePoint = codePoint * 16 + static_cast<unsigned long>(h - 'a' + 10);
+        else if (h >= 'A' && h <= 'F')
+            codePoint = codePoint * 16 + static_cast<unsigned long>(h - 'A' + 10);
+        else
+            return fail("invalid unicode escape sequence");
+    }
+
+    ResultsParser::appendUtf8(output, codePoint);
+    return true;
+}
+
+bool TurtleParser::expect(char c)
+{
+    if (m_current < m_end && *m_current == c)
+    {
+        m_current++;
+        return true;
+    }
+
+    return fail(std::string("expected '") + c + "'");
+}
+
+bool TurtleParser::isKeyword(const std::string &keyword) const
+{
+    if (m_end - m_current < static_cast<long>(keyword.size()))
+    {
+        return false;
+    }
+
+    for (unsigned long i = 0; i < keyword.size(); i++)
+    {
+        if (std::tolower(static_cast<unsigned char>(m_current[i])) != std::tolower(static_cast<unsigned char>(keyword[i])))
+        {
+            return false;
+        }
+    }
+
+    const char *next = m_current + keyword.size();
+    return next == m_end || (!isNameChar(*next) && *next != ':');
+}
+
+void TurtleParser::skipWhitespace()
+{
+    while (m_current < m_end)
+    {
+        char c = *m_current;
+
+        if (c == ' ' || c == '\t' || c == '\n' || c == '\r')
+        {
+            m_current++;
+        }
+
+        else if (c == '#')
+        {
+            while (m_current < m_end && *m_current != '\n')
+            {
+                m_current++;
+            }
+        }
+
+        else
+        {
+            break;
+        }
+    }
+}
+
+void TurtleParser::addTriple(unsigned int subject, unsigned int predicate, unsigned int object)
+{
+    m_triples.push_back({subject, predicate, object});
+}
+
+unsigned int TurtleParser::newBlankNode()
+{
+    // '#' cannot appear in blank node labels of the document
+    m_blankNodesCount++;
+    return m_terms.getElementIndex("B#" + std::to_string(m_blankNodesCount));
+}
+
+std::string TurtleParser::resolveIri(const std::string &iri) const
+{
+    if (m_base.empty())
+    {
+        return iri;
+    }
+
+    // Absolute IRI: scheme ':' ...
+    unsigned long i(0);
+    while (i < iri.size() && (std::isalnum(static_cast<unsigned char>(iri[i])) || iri[i] == '+' || iri[i] == '-' || iri[i] == '.'))
+    {
+        i++;
+    }
+
+    if (i > 0 && i < iri.size() && iri[i] == ':' && std::isalpha(static_cast<unsigned char>(iri[0])))
+    {
+        return iri;
+    }
+
+    // Relative references (RFC 3986, section 5.2)
+    std::string base = m_base.substr(0, m_base.find('#'));
+    if (iri.empty())
+    {
+        return base;
+    }
+
+    if (iri[0] == '#')
+    {
+        return base + iri;
+    }
+
+    unsigned long schemeEnd = base.find(':');
+    if (iri.compare(0, 2, "//") == 0)
+    {
+        return base.substr(0, schemeEnd + 1) + iri;
+    }
+
+    unsigned long authorityEnd = (base.compare(schemeEnd + 1, 2, "//") == 0) ? base.find('/', schemeEnd + 3) : schemeEnd + 1;
+    if (authorityEnd == std::string::npos)
+    {
+        authorityEnd = base.size();
+    }
+
+    std::string path;
+    if (iri[0] == '/')
+    {
+        path = iri;
+    }
+
+    else
+    {
+        unsigned long lastSlash = base.rfind('/');
+        if (lastSlash == std::string::npos || lastSlash < authorityEnd)
+            path = "/" + iri;
+        else
+            path = base.substr(authorityEnd, lastSlash + 1 - authorityEnd) + iri;
+    }
+
+    // Remove dot segments of the path (before any query or fragment)
+    unsigned long pathEnd = std::min(path.find('?'), path.find('#'));
+    std::string suffix = (pathEnd == std::string::npos) ? "" : path.substr(pathEnd);
+    std::string input = path.substr(0, pathEnd);
+    std::string output;
+
+    while (!input.empty())
+    {
+        if (input.compare(0, 3, "../") == 0)
+            input.erase(0, 3);
+        else if (input.compare(0, 2, "./") == 0 || input.compare(0, 3, "/./") == 0)
+            input.erase(0, 2);
+        else if (input == "/.")
+            input = "/";
+        else if (input.compare(0, 4, "/../") == 0 || input == "/..")
+        {
+            input.replace(0, (input == "/..") ? 3 : 4, "/");
+            unsigned long lastSegment = output.rfind('/');
+            output.erase((lastSegment == std::string::npos) ? 0 : lastSegment);
+        }
+        else if (input == "." || input == "..")
+            input.clear();
+        else
+        {
+            unsigned long segmentEnd = input.find('/', 1);
+            output += input.substr(0, segmentEnd);
+            input.erase(0, segmentEnd);
+        }
+    }
+
+    return base.substr(0, authorityEnd) + output + suffix;
+}
+
+bool TurtleParser::fail(const std::string &error)
+{
+    if (m_error.empty())
+    {
+        m_error = error;
+    }
+
+    return false;
+}
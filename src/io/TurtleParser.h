@@ -0,0 +1,64 @@
+#ifndef TCN3R_TURTLEPARSER_H
+#define TCN3R_TURTLEPARSER_H
+
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "CacheManager.h"
+
+struct Triple
+{
+    unsigned int subject;
+    unsigned int predicate;
+    unsigned int object;
+};
+
+// Parser of Turtle documents (N-Triples being a subset of Turtle) held in memory
+// Terms are interned as keys made of their kind ('I' for IRIs, 'B' for blank nodes, 'L' for literals) followed by the
+// value given for them in SPARQL results: IRIs are resolved, literals lose their language or datatype
+class TurtleParser
+{
+    public:
+        TurtleParser(const char *begin, const char *end, CacheManager &terms, std::vector<Triple> &triples);
+        bool parse();
+        std::string getError() const;
+        const char* getPosition() const;
+
+    private:
+        bool parseDirective();
+        bool parseTriples();
+        bool parsePredicateObjectList(unsigned int subject);
+        bool parseObjectList(unsigned int subject, unsigned int predicate);
+        bool parseTerm(unsigned int &term, bool predicate);
+        bool parseIri(std::string &iri);
+        bool parsePrefixedName(std::string &iri);
+        bool parseBlankNodeLabel(std::string &label);
+        bool parseBlankNodePropertyList(unsigned int &term);
+        bool parseCollection(unsigned int &term);
+        bool parseLiteral(std::string &value);
+        bool parseString(std::string &value);
+        bool parseNumber(std::string &value);
+        bool parseUnicodeEscape(std::string &output, int digits);
+        bool expect(char c);
+        bool isKeyword(const std::string &keyword) const;
+        void skipWhitespace();
+        void addTriple(unsigned int subject, unsigned int predicate, unsigned int object);
+        unsigned int newBlankNode();
+        std::string resolveIri(const std::string &iri) const;
+        bool fail(const std::string &error);
+
+        const char *m_current;
+        const char *m_end;
+        CacheManager &m_terms;
+        std::vector<Triple> &m_triples;
+
+        std::map<std::string, std::string> m_prefixes;
+        std::string m_base;
+        unsigned long m_blankNodesCount;
+        std::string m_error;
+};
+
+
+#endif //TCN3R_TURTLEPARSER_H
@@ -1,13 +1,16 @@
 #include <iostream>
+#include <memory>
 #include <string>
 
 #include <boost/program_options.hpp>
 #include <curl/curl.h>
 
 #include "configuration/Configuration.h"
-#include "io/CacheManager.h"
+#include "io/DumpManager.h"
 #include "io/Logger.h"
 #include "io/ServerManager.h"
+#include "io/SnapshotReader.h"
+#include "io/SnapshotWriter.h"
 #include "io/TTLWriter.h"
 #include "model/Relation.h"
 #include "reconciliation/RelationNotFound.h"
@@ -74,6 +77,16 @@ int main(int argc, char* argv[])
                     boost::program_options::value<bool>()->default_value(false),
                     "Launch the program in explain mode (interactive)"
                 )
+                (
+                    "phase",
+                    boost::program_options::value<std::string>()->default_value("all"),
+                    "Phase to run: ingest (build the model and write it to the snapshot), compare (read the model from the snapshot and compare relations) or all"
+                )
+                (
+                    "snapshot",
+                    boost::program_options::value<std::string>()->default_value(""),
+                    "Path to the binary snapshot of the model (required by the ingest and compare phases, written by the all phase if given)"
+                )
                 ;
 
         boost::program_options::variables_map argsParsed;
@@ -96,12 +109,60 @@ int main(int argc, char* argv[])
                 logger);
         logger.info(parameters.toString());
 
-        // Prepare ServerManager
-        ServerManager serverManager(parameters, logger);
-        CacheManager cacheManager;
+        std::string phase(argsParsed["phase"].as<std::string>());
+        std::string snapshotPath(argsParsed["snapshot"].as<std::string>());
+        if (phase != "all" && phase != "ingest" && phase != "compare")
+        {
+            logger.critical("Unknown phase: " + phase + " (expected all, ingest or compare)");
+            std::exit(-1);
+        }
+
+        if (phase != "all" && snapshotPath.empty())
+        {
+            logger.critical("The " + phase + " phase requires a snapshot file (--snapshot)");
+            std::exit(-1);
+        }
+
+        std::unique_ptr<RelationsReconcilier> relationsReconciliatorPtr;
+
+        // Compare phase: the model is read from the snapshot, the triplestore is not queried
+        if (phase == "compare")
+        {
+            logger.info("Read snapshot: " + snapshotPath);
+            SnapshotReader snapshotReader(snapshotPath, logger);
+            relationsReconciliatorPtr.reset(new RelationsReconcilier(snapshotReader, parameters, logger));
+        }
+
+        else
+        {
+            // Prepare ServerManager, or DumpManager if triples are read from a local dump
+            std::unique_ptr<TriplestoreManager> triplestoreManager;
+            if (parameters.getDumpFile().empty())
+                triplestoreManager.reset(new ServerManager(parameters, logger));
+            else
+                triplestoreManager.reset(new DumpManager(parameters, logger));
+
+            // Build the relations reconciliator object
+            relationsReconciliatorPtr.reset(new RelationsReconcilier(*triplestoreManager, parameters, logger));
+            triplestoreManager->reportStatistics(logger);
+
+            if (!snapshotPath.empty())
+            {
+                logger.info("Write snapshot: " + snapshotPath);
+                SnapshotWriter snapshotWriter(snapshotPath, logger);
+                relationsReconciliatorPtr->writeSnapshot(snapshotWriter, parameters);
+                snapshotWriter.close();
+            }
+
+            // Ingest phase: stop once the snapshot is written
+            if (phase == "ingest")
+            {
+                curl_global_cleanup();
+                return 0;
+            }
+        }
 
-        // Build the relations reconciliator object
-        RelationsReconcilier relationsReconciliator(serverManager, parameters, logger);
+        RelationsReconcilier &relationsReconciliator = *relationsReconciliatorPtr;
 
         // Explain mode
         if (parameters.isExplainMode())
@@ -153,7 +214,8 @@ int main(int argc, char* argv[])
         {
             logger.info("Start batch reconciliation");
             TTLWriter ttlWriter(parameters.getOutputPath(), logger);
-            relationsReconciliator.reconcileBatch(ttlWriter, parameters);
+            relationsReconciliator.indexDimensions(logger);
+            relationsReconciliator.reconcileBatch(ttlWriter, parameters, logger);
         }
     }
     catch (std::exception &e)
@@ -0,0 +1,48 @@
+#include <algorithm>
+
+#include "Adjacency.h"
+
+
+Adjacency::Adjacency() : m_offsets(1, 0), m_neighbours()
+{
+
+}
+
+Adjacency::Adjacency(std::vector<std::pair<unsigned int, unsigned int>> &edges, unsigned int nodesCount) :
+        m_offsets(nodesCount + 1, 0), m_neighbours()
+{
+    // Edges (source, neighbour) are sorted in place, the neighbours of each source become contiguous
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+    m_neighbours.reserve(edges.size());
+    for (const auto &e : edges)
+    {
+        m_offsets[e.first + 1]++;
+        m_neighbours.push_back(e.second);
+    }
+
+    for (unsigned int n = 0; n < nodesCount; n++)
+    {
+        m_offsets[n + 1] += m_offsets[n];
+    }
+}
+
+AdjacencyRange Adjacency::getNeighbours(unsigned int node) const
+{
+    AdjacencyRange range;
+
+    // Nodes added after the adjacency was built have no neighbours
+    if (node < getNodesCount())
+    {
+        range.first = m_neighbours.data() + m_offsets[node];
+        range.last = m_neighbours.data() + m_offsets[node + 1];
+    }
+
+    return range;
+}
+
+unsigned int Adjacency::getNodesCount() const
+{
+    return static_cast<unsigned int>(m_offsets.size() - 1);
+}
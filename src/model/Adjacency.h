@@ -0,0 +1,35 @@
+#ifndef TCN3R_ADJACENCY_H
+#define TCN3R_ADJACENCY_H
+
+
+#include <utility>
+#include <vector>
+
+// Contiguous range of the neighbours of a node
+struct AdjacencyRange
+{
+    const unsigned int *first = nullptr;
+    const unsigned int *last = nullptr;
+
+    const unsigned int* begin() const { return first; }
+    const unsigned int* end() const { return last; }
+    bool empty() const { return first == last; }
+};
+
+// Frozen adjacency of a graph over dense node identifiers, in compressed sparse row format: the neighbours of node n
+// are m_neighbours[m_offsets[n]] to m_neighbours[m_offsets[n + 1] - 1], sorted and without duplicates
+class Adjacency
+{
+    public:
+        Adjacency();
+        Adjacency(std::vector<std::pair<unsigned int, unsigned int>> &edges, unsigned int nodesCount);
+        AdjacencyRange getNeighbours(unsigned int node) const;
+        unsigned int getNodesCount() const;
+
+    private:
+        std::vector<unsigned int> m_offsets;
+        std::vector<unsigned int> m_neighbours;
+};
+
+
+#endif //TCN3R_ADJACENCY_H
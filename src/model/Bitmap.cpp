@@ -0,0 +1,68 @@
+#include "Bitmap.h"
+
+
+Bitmap::Bitmap() : m_words()
+{
+
+}
+
+Bitmap::Bitmap(unsigned int size) : m_words((size + 63) / 64, 0)
+{
+
+}
+
+void Bitmap::set(unsigned int element)
+{
+    if (element / 64 >= m_words.size())
+    {
+        m_words.resize(element / 64 + 1, 0);
+    }
+
+    m_words[element / 64] |= std::uint64_t(1) << (element % 64);
+}
+
+void Bitmap::unite(const Bitmap &other)
+{
+    if (other.m_words.size() > m_words.size())
+    {
+        m_words.resize(other.m_words.size(), 0);
+    }
+
+    for (unsigned long w = 0; w < other.m_words.size(); w++)
+    {
+        m_words[w] |= other.m_words[w];
+    }
+}
+
+bool Bitmap::test(unsigned int element) const
+{
+    return element / 64 < m_words.size() && (m_words[element / 64] >> (element % 64) & 1);
+}
+
+unsigned int Bitmap::count() const
+{
+    unsigned int count(0);
+    for (const auto &word : m_words)
+    {
+        count += static_cast<unsigned int>(__builtin_popcountll(word));
+    }
+
+    return count;
+}
+
+std::vector<unsigned int> Bitmap::getElements() const
+{
+    // Elements in increasing order
+    std::vector<unsigned int> elements;
+    elements.reserve(count());
+
+    for (unsigned int w = 0; w < m_words.size(); w++)
+    {
+        for (std::uint64_t word = m_words[w]; word != 0; word &= word - 1)
+        {
+            elements.push_back(w * 64 + static_cast<unsigned int>(__builtin_ctzll(word)));
+        }
+    }
+
+    return elements;
+}
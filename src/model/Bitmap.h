@@ -0,0 +1,25 @@
+#ifndef TCN3R_BITMAP_H
+#define TCN3R_BITMAP_H
+
+
+#include <cstdint>
+#include <vector>
+
+// Set of dense identifiers stored as one bit per identifier: constant time membership tests
+class Bitmap
+{
+    public:
+        Bitmap();
+        explicit Bitmap(unsigned int size);
+        void set(unsigned int element);
+        void unite(const Bitmap &other);
+        bool test(unsigned int element) const;
+        unsigned int count() const;
+        std::vector<unsigned int> getElements() const;
+
+    private:
+        std::vector<std::uint64_t> m_words;
+};
+
+
+#endif //TCN3R_BITMAP_H
@@ -0,0 +1,215 @@
+#include <algorithm>
+
+#include "CompressedBitmap.h"
+
+// Number of 64-bit words of a bitmap container, and greatest size of an array container (beyond which a bitmap is
+// smaller)
+#define BITMAP_CONTAINER_WORDS 1024
+#define ARRAY_CONTAINER_MAX_SIZE 4096
+
+
+CompressedBitmap::CompressedBitmap() : m_containers()
+{
+
+}
+
+CompressedBitmap::CompressedBitmap(const std::vector<unsigned int> &elements) : m_containers()
+{
+    // Elements are sorted and without duplicates
+    std::vector<std::uint16_t> lowBits;
+    lowBits.reserve(elements.size());
+    for (const auto &element : elements)
+    {
+        lowBits.push_back(static_cast<std::uint16_t>(element & 0xFFFF));
+    }
+
+    unsigned long first(0);
+    while (first < elements.size())
+    {
+        unsigned long last(first);
+        while (last < elements.size() && elements[last] >> 16 == elements[first] >> 16)
+        {
+            last++;
+        }
+
+        m_containers.push_back(createContainer(static_cast<std::uint16_t>(elements[first] >> 16),
+                                               lowBits.begin() + first, lowBits.begin() + last));
+        first = last;
+    }
+}
+
+CompressedBitmap::Container CompressedBitmap::createContainer(std::uint16_t key,
+                                                              std::vector<std::uint16_t>::const_iterator first,
+                                                              std::vector<std::uint16_t>::const_iterator last)
+{
+    Container container{key, ARRAY, std::vector<std::uint16_t>(), std::vector<std::uint64_t>()};
+
+    std::vector<std::uint16_t> runs;
+    for (auto it = first; it != last; it++)
+    {
+        if (runs.empty() || *it != runs[runs.size() - 2] + runs.back() + 1)
+        {
+            runs.push_back(*it);
+            runs.push_back(0);
+        }
+
+        else
+        {
+            runs.back()++;
+        }
+    }
+
+    // Sizes in 16-bit values
+    auto arraySize = static_cast<unsigned long>(last - first);
+    unsigned long bitmapSize(BITMAP_CONTAINER_WORDS * 4);
+
+    if (runs.size() < arraySize && runs.size() < bitmapSize)
+    {
+        container.type = RUNS;
+        container.values = std::move(runs);
+    }
+
+    else if (arraySize <= ARRAY_CONTAINER_MAX_SIZE)
+    {
+        container.values.assign(first, last);
+    }
+
+    else
+    {
+        container.type = BITMAP;
+        container.words.assign(BITMAP_CONTAINER_WORDS, 0);
+        for (auto it = first; it != last; it++)
+        {
+            container.words[*it / 64] |= std::uint64_t(1) << (*it % 64);
+        }
+    }
+
+    return container;
+}
+
+const CompressedBitmap::Container* CompressedBitmap::findContainer(std::uint16_t key) const
+{
+    auto it = std::lower_bound(m_containers.begin(), m_containers.end(), key,
+                               [](const Container &c, std::uint16_t k) { return c.key < k; });
+
+    return (it != m_containers.end() && it->key == key) ? &(*it) : nullptr;
+}
+
+bool CompressedBitmap::contains(unsigned int element) const
+{
+    const Container *container = findContainer(static_cast<std::uint16_t>(element >> 16));
+    return container && contains(*container, static_cast<std::uint16_t>(element & 0xFFFF));
+}
+
+bool CompressedBitmap::contains(const Container &container, std::uint16_t value)
+{
+    switch (container.type)
+    {
+        case ARRAY:
+            return std::binary_search(container.values.begin(), container.values.end(), value);
+
+        case BITMAP:
+            return (container.words[value / 64] >> (value % 64)) & 1;
+
+        case RUNS:
+        {
+            // Last run starting at or before the value
+            unsigned long low(0), high(container.values.size() / 2);
+            while (low < high)
+            {
+                unsigned long middle = (low + high) / 2;
+                if (container.values[2 * middle] <= value)
+                {
+                    low = middle + 1;
+                }
+
+                else
+                {
+                    high = middle;
+                }
+            }
+
+            return low > 0 && value - container.values[2 * (low - 1)] <= container.values[2 * (low - 1) + 1];
+        }
+    }
+
+    return false;
+}
+
+bool CompressedBitmap::isSubsetOf(const CompressedBitmap &other) const
+{
+    for (const auto &container : m_containers)
+    {
+        const Container *otherContainer = other.findContainer(container.key);
+        if (!otherContainer || !isSubsetOf(container, *otherContainer))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool CompressedBitmap::isSubsetOf(const Container &container, const Container &other)
+{
+    if (container.type == BITMAP && other.type == BITMAP)
+    {
+        // Word operations over the whole chunk, vectorized by the compiler
+        std::uint64_t extra(0);
+        for (unsigned int w = 0; w < BITMAP_CONTAINER_WORDS; w++)
+        {
+            extra |= container.words[w] & ~other.words[w];
+        }
+
+        return extra == 0;
+    }
+
+    switch (container.type)
+    {
+        case ARRAY:
+            for (const auto &value : container.values)
+            {
+                if (!contains(other, value))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+
+        case BITMAP:
+            for (unsigned int w = 0; w < BITMAP_CONTAINER_WORDS; w++)
+            {
+                for (std::uint64_t word = container.words[w]; word != 0; word &= word - 1)
+                {
+                    if (!contains(other, static_cast<std::uint16_t>(w * 64 + __builtin_ctzll(word))))
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+
+        case RUNS:
+            for (unsigned long r = 0; r < container.values.size(); r += 2)
+            {
+                for (unsigned int value = container.values[r]; value <= container.values[r] + container.values[r + 1]; value++)
+                {
+                    if (!contains(other, static_cast<std::uint16_t>(value)))
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+    }
+
+    return false;
+}
+
+bool CompressedBitmap::empty() const
+{
+    return m_containers.empty();
+}
@@ -0,0 +1,48 @@
+#ifndef TCN3R_COMPRESSEDBITMAP_H
+#define TCN3R_COMPRESSEDBITMAP_H
+
+
+#include <cstdint>
+#include <vector>
+
+// Immutable compressed set of dense identifiers (roaring-style): identifiers are split in chunks of 2^16 by their
+// high 16 bits, each chunk being stored as a sorted array, a bitmap or a list of runs, whichever is the smallest
+class CompressedBitmap
+{
+    public:
+        CompressedBitmap();
+        explicit CompressedBitmap(const std::vector<unsigned int> &elements);
+        bool contains(unsigned int element) const;
+        bool isSubsetOf(const CompressedBitmap &other) const;
+        bool empty() const;
+
+    private:
+        enum ContainerType
+        {
+            ARRAY,
+            BITMAP,
+            RUNS
+        };
+
+        // Low 16 bits of the identifiers of a chunk: values of an array, (start, length - 1) pairs of runs, or
+        // 1024 words of a bitmap
+        struct Container
+        {
+            std::uint16_t key;
+            ContainerType type;
+            std::vector<std::uint16_t> values;
+            std::vector<std::uint64_t> words;
+        };
+
+        static Container createContainer(std::uint16_t key, std::vector<std::uint16_t>::const_iterator first,
+                                         std::vector<std::uint16_t>::const_iterator last);
+        static bool contains(const Container &container, std::uint16_t value);
+        static bool isSubsetOf(const Container &container, const Container &other);
+        const Container* findContainer(std::uint16_t key) const;
+
+        // Containers sorted by key
+        std::vector<Container> m_containers;
+};
+
+
+#endif //TCN3R_COMPRESSEDBITMAP_H
@@ -0,0 +1,62 @@
+#include <utility>
+
+#include "DisjointSets.h"
+
+
+DisjointSets::DisjointSets() : m_parents(), m_sizes()
+{
+
+}
+
+void DisjointSets::unite(unsigned int a, unsigned int b)
+{
+    unsigned int rootA = find(a);
+    unsigned int rootB = find(b);
+
+    if (rootA == rootB)
+    {
+        return;
+    }
+
+    // The smallest set is attached to the largest one
+    if (m_sizes[rootA] < m_sizes[rootB])
+    {
+        std::swap(rootA, rootB);
+    }
+
+    m_parents[rootB] = rootA;
+    m_sizes[rootA] += m_sizes[rootB];
+}
+
+unsigned int DisjointSets::find(unsigned int a)
+{
+    grow(a);
+
+    while (m_parents[a] != a)
+    {
+        m_parents[a] = m_parents[m_parents[a]];
+        a = m_parents[a];
+    }
+
+    return a;
+}
+
+unsigned int DisjointSets::getSize(unsigned int a)
+{
+    return m_sizes[find(a)];
+}
+
+unsigned int DisjointSets::getElementsCount() const
+{
+    return static_cast<unsigned int>(m_parents.size());
+}
+
+void DisjointSets::grow(unsigned int a)
+{
+    // Identifiers not seen yet are singletons
+    while (m_parents.size() <= a)
+    {
+        m_parents.push_back(static_cast<unsigned int>(m_parents.size()));
+        m_sizes.push_back(1);
+    }
+}
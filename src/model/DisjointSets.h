@@ -0,0 +1,25 @@
+#ifndef TCN3R_DISJOINTSETS_H
+#define TCN3R_DISJOINTSETS_H
+
+
+#include <vector>
+
+// Union-find over dense identifiers (union by size, path halving): near-constant time per union and find
+class DisjointSets
+{
+    public:
+        DisjointSets();
+        void unite(unsigned int a, unsigned int b);
+        unsigned int find(unsigned int a);
+        unsigned int getSize(unsigned int a);
+        unsigned int getElementsCount() const;
+
+    private:
+        void grow(unsigned int a);
+
+        std::vector<unsigned int> m_parents;
+        std::vector<unsigned int> m_sizes;
+};
+
+
+#endif //TCN3R_DISJOINTSETS_H
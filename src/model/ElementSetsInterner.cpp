@@ -0,0 +1,37 @@
+#include "ElementSetsInterner.h"
+
+
+ElementSetsInterner::ElementSetsInterner() : m_ids(), m_sets(), m_uses()
+{
+
+}
+
+unsigned int ElementSetsInterner::getId(const std::set<RelationElement*> &elements)
+{
+    auto it = m_ids.find(elements);
+    if (it == m_ids.end())
+    {
+        // Keys of the map are not moved by later insertions
+        it = m_ids.emplace(elements, static_cast<unsigned int>(m_sets.size())).first;
+        m_sets.push_back(&it->first);
+        m_uses.push_back(0);
+    }
+
+    m_uses[it->second]++;
+    return it->second;
+}
+
+const std::set<RelationElement*>& ElementSetsInterner::getSet(unsigned int id) const
+{
+    return *m_sets[id];
+}
+
+unsigned int ElementSetsInterner::size() const
+{
+    return static_cast<unsigned int>(m_sets.size());
+}
+
+bool ElementSetsInterner::isShared(unsigned int id) const
+{
+    return m_uses[id] > 1;
+}
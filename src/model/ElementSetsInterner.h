@@ -0,0 +1,30 @@
+#ifndef TCN3R_ELEMENTSETSINTERNER_H
+#define TCN3R_ELEMENTSETSINTERNER_H
+
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include "RelationElement.h"
+
+// Distinct sets of relation elements (dimensions of relations), interned before the batch reconciliation: equal sets
+// share a dense identifier, and the canonical set of an identifier is kept for the whole reconciliation. The number of
+// dimensions interned with each identifier is counted, to only memoize comparisons of sets used more than once
+class ElementSetsInterner
+{
+    public:
+        ElementSetsInterner();
+        unsigned int getId(const std::set<RelationElement*> &elements);
+        const std::set<RelationElement*>& getSet(unsigned int id) const;
+        unsigned int size() const;
+        bool isShared(unsigned int id) const;
+
+    private:
+        std::map<std::set<RelationElement*>, unsigned int> m_ids;
+        std::vector<const std::set<RelationElement*>*> m_sets;
+        std::vector<unsigned int> m_uses;
+};
+
+
+#endif //TCN3R_ELEMENTSETSINTERNER_H
@@ -0,0 +1,213 @@
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <unordered_set>
+#include <utility>
+
+#include "ElementsHierarchy.h"
+
+
+ElementsHierarchy::ElementsHierarchy() : m_parents(), m_nodes(), m_elements(), m_index(), m_children()
+{
+
+}
+
+ElementsHierarchy::ElementsHierarchy(std::map<RelationElement*, std::set<RelationElement*>> parents) :
+        m_parents(std::move(parents)), m_nodes(), m_elements(), m_index(), m_children()
+{
+    // Temporary identifiers in the order of the map
+    std::unordered_map<RelationElement*, unsigned int> ids;
+    std::vector<RelationElement*> elements;
+    auto getId = [&ids, &elements](RelationElement *el) {
+        auto it = ids.emplace(el, static_cast<unsigned int>(elements.size()));
+        if (it.second)
+        {
+            elements.push_back(el);
+        }
+
+        return it.first->second;
+    };
+
+    std::vector<std::pair<unsigned int, unsigned int>> edges;
+    for (const auto &el2p : m_parents)
+    {
+        unsigned int id = getId(el2p.first);
+        for (const auto &parent : el2p.second)
+        {
+            edges.emplace_back(getId(parent), id);
+        }
+    }
+
+    auto elementsCount = static_cast<unsigned int>(elements.size());
+    std::vector<bool> hasParent(elementsCount, false);
+    for (const auto &e : edges)
+    {
+        hasParent[e.second] = true;
+    }
+
+    Adjacency children(edges, elementsCount);
+
+    // Depth-first numbering from the roots, then from the elements left (only reached through cycles)
+    const unsigned int unnumbered = std::numeric_limits<unsigned int>::max();
+    std::vector<unsigned int> numbers(elementsCount, unnumbered);
+    unsigned int numbersCount(0);
+    auto number = [&children, &numbers, &numbersCount, unnumbered](unsigned int root) {
+        std::vector<unsigned int> toNumber({root});
+        while (!toNumber.empty())
+        {
+            unsigned int id = toNumber.back();
+            toNumber.pop_back();
+
+            if (numbers[id] == unnumbered)
+            {
+                numbers[id] = numbersCount++;
+                AdjacencyRange range(children.getNeighbours(id));
+                toNumber.insert(toNumber.end(), std::make_reverse_iterator(range.end()),
+                                std::make_reverse_iterator(range.begin()));
+            }
+        }
+    };
+
+    for (unsigned int id = 0; id < elementsCount; id++)
+    {
+        if (!hasParent[id])
+        {
+            number(id);
+        }
+    }
+
+    for (unsigned int id = 0; id < elementsCount; id++)
+    {
+        number(id);
+    }
+
+    m_elements.resize(elementsCount);
+    for (unsigned int id = 0; id < elementsCount; id++)
+    {
+        m_nodes.emplace(elements[id], numbers[id]);
+        m_elements[numbers[id]] = elements[id];
+    }
+
+    // Edges (parent, child) sorted by Adjacency are renumbered, then reversed for the index
+    for (auto &e : edges)
+    {
+        e = std::make_pair(numbers[e.first], numbers[e.second]);
+    }
+
+    m_children = Adjacency(edges, elementsCount);
+
+    for (auto &e : edges)
+    {
+        std::swap(e.first, e.second);
+    }
+
+    m_index = ReachabilityIndex(edges, elementsCount);
+}
+
+const std::map<RelationElement*, std::set<RelationElement*>>& ElementsHierarchy::getParents() const
+{
+    return m_parents;
+}
+
+bool ElementsHierarchy::isAncestorOrSelf(RelationElement *el, RelationElement *ancestor) const
+{
+    if (el == ancestor)
+    {
+        return true;
+    }
+
+    unsigned int node(0), ancestorNode(0);
+    if (!findNode(el, node) || !findNode(ancestor, ancestorNode))
+    {
+        return false;
+    }
+
+    return m_index.reaches(node, ancestorNode);
+}
+
+bool ElementsHierarchy::findNode(RelationElement *el, unsigned int &node) const
+{
+    auto it = m_nodes.find(el);
+    if (it == m_nodes.end())
+    {
+        return false;
+    }
+
+    node = it->second;
+    return true;
+}
+
+RelationElement* ElementsHierarchy::getElement(unsigned int node) const
+{
+    return m_elements[node];
+}
+
+std::vector<unsigned int> ElementsHierarchy::getNodes(const std::set<RelationElement*> &elements) const
+{
+    // Sorted nodes of the elements in the hierarchy
+    std::vector<unsigned int> nodes;
+    for (const auto &el : elements)
+    {
+        unsigned int node(0);
+        if (findNode(el, node))
+        {
+            nodes.push_back(node);
+        }
+    }
+
+    std::sort(nodes.begin(), nodes.end());
+    return nodes;
+}
+
+std::vector<unsigned int> ElementsHierarchy::getDescendantsOrSelf(const std::vector<unsigned int> &nodes) const
+{
+    // Sorted nodes reached from the given nodes through children
+    std::unordered_set<unsigned int> descendants(nodes.begin(), nodes.end());
+    std::vector<unsigned int> toExpand(descendants.begin(), descendants.end());
+
+    while (!toExpand.empty())
+    {
+        unsigned int node = toExpand.back();
+        toExpand.pop_back();
+
+        for (const auto &child : m_children.getNeighbours(node))
+        {
+            if (descendants.insert(child).second)
+            {
+                toExpand.push_back(child);
+            }
+        }
+    }
+
+    std::vector<unsigned int> sortedDescendants(descendants.begin(), descendants.end());
+    std::sort(sortedDescendants.begin(), sortedDescendants.end());
+    return sortedDescendants;
+}
+
+std::set<RelationElement*> ElementsHierarchy::getAncestorsOrSelf(const std::set<RelationElement*> &elements) const
+{
+    std::set<RelationElement*> ancestors(elements);
+    std::vector<RelationElement*> toExpand(elements.begin(), elements.end());
+
+    while (!toExpand.empty())
+    {
+        RelationElement *el = toExpand.back();
+        toExpand.pop_back();
+
+        auto it = m_parents.find(el);
+        if (it == m_parents.end())
+        {
+            continue;
+        }
+
+        for (const auto &parent : it->second)
+        {
+            if (ancestors.insert(parent).second)
+            {
+                toExpand.push_back(parent);
+            }
+        }
+    }
+
+    return ancestors;
+}
@@ -0,0 +1,41 @@
+#ifndef TCN3R_ELEMENTSHIERARCHY_H
+#define TCN3R_ELEMENTSHIERARCHY_H
+
+
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include "Adjacency.h"
+#include "ReachabilityIndex.h"
+#include "RelationElement.h"
+
+// Hierarchy of relation elements given by the direct parents of each element. Only the direct parents are stored,
+// transitive ancestors are answered by a reachability index. Elements of the hierarchy are numbered depth-first from
+// the roots, so that the descendants of an element mostly have consecutive numbers
+class ElementsHierarchy
+{
+    public:
+        ElementsHierarchy();
+        explicit ElementsHierarchy(std::map<RelationElement*, std::set<RelationElement*>> parents);
+        const std::map<RelationElement*, std::set<RelationElement*>>& getParents() const;
+        bool isAncestorOrSelf(RelationElement *el, RelationElement *ancestor) const;
+        bool findNode(RelationElement *el, unsigned int &node) const;
+        RelationElement* getElement(unsigned int node) const;
+        std::vector<unsigned int> getNodes(const std::set<RelationElement*> &elements) const;
+        std::vector<unsigned int> getDescendantsOrSelf(const std::vector<unsigned int> &nodes) const;
+        std::set<RelationElement*> getAncestorsOrSelf(const std::set<RelationElement*> &elements) const;
+
+    private:
+        std::map<RelationElement*, std::set<RelationElement*>> m_parents;
+
+        // Nodes of the index, their elements and children of each node
+        std::unordered_map<RelationElement*, unsigned int> m_nodes;
+        std::vector<RelationElement*> m_elements;
+        ReachabilityIndex m_index;
+        Adjacency m_children;
+};
+
+
+#endif //TCN3R_ELEMENTSHIERARCHY_H
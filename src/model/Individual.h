@@ -2,30 +2,27 @@
 #define TCN3R_INDIVIDUAL_H
 
 
-#include <map>
 #include <set>
+#include <string>
+#include <vector>
 
-#include "../io/CacheManager.h"
-#include "Predicate.h"
+#include "URIsInterner.h"
 
+// Canonical individual (URIs linked by owl:sameAs), its edges are held by its IndividualsSet
 class Individual
 {
     public:
-        explicit Individual(std::set<std::string> uris);
-        std::set<std::string> getURIs() const;
-        void addEdge(Predicate *predicate, Individual *target);
-        std::set<Individual*> getInstances(Predicate *type, Predicate *subClassOf);
-        std::set<Individual*> getAdjacentIndividuals(Predicate *p);
-        bool matchesPrefixes(const std::set<std::string> &prefixes);
-        std::set<Individual*> getAncestors(const std::set<Predicate*> &leqPredicate, const std::set<Predicate*> &geqPredicate);
+        Individual(std::vector<URIId> uris, unsigned int index);
+        const std::vector<URIId>& getURIs() const;
+        unsigned int getIndex() const;
+        bool matchesPrefixes(const std::set<std::string> &prefixes) const;
 
     private:
-        std::set<Individual*> getDescendants(Predicate *subClassOf);
-        void addInvEdge(Predicate *predicate, Individual *source);
+        // Sorted identifiers of the URIs (aliases through owl:sameAs)
+        const std::vector<URIId> m_uris;
 
-        const std::set<std::string> m_uris;
-        std::map<Predicate*, std::set<Individual*>> m_adjacency;
-        std::map<Predicate*, std::set<Individual*>> m_invAdjacency;
+        // Dense identifier of the individual in its IndividualsSet
+        const unsigned int m_index;
 };
 
 
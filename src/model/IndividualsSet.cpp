@@ -1,99 +1,225 @@
-#include <boost/progress.hpp>
+#include <algorithm>
 
+#include "DisjointSets.h"
 #include "IndividualsSet.h"
 
 
-IndividualsSet::IndividualsSet(const ServerManager &serverManager, const Logger &logger) : m_uriToIndividual()
+IndividualsSet::IndividualsSet(const TriplestoreManager &triplestoreManager, const std::set<std::string> &sameAsWhereClauses,
+                               unsigned long capacity, const Logger &logger) : m_individuals(), m_indexToIndividual(),
+                                                                               m_edges(), m_adjacency(), m_invAdjacency()
 {
-    // Query owl:sameAs links to compute canonical graph
+    // Query owl:sameAs links and merge the sets of linked URIs as edges arrive
     logger.info("Query owl:sameAs edges");
-    std::set<std::pair<std::string, std::string>> sameAsEdges = serverManager.queryTwoElements("?e1 owl:sameAs ?e2");
-
-    // Build owl:sameAs adjacency
-    logger.info("Build owl:sameAs adjacency from edges");
-    std::map<std::string, std::set<std::string>> sameAsAdjacency;
-
-    boost::progress_display progressBar(sameAsEdges.size());
-    for (const auto &e : sameAsEdges)
+    DisjointSets sameAsSets;
+    unsigned long edgesCount(0);
+    for (const auto &whereClause : sameAsWhereClauses)
     {
-        sameAsAdjacency[e.first].insert(e.second);
-        sameAsAdjacency[e.second].insert(e.first);
-
-        ++progressBar;
+        triplestoreManager.queryRowsPipelined({"e1", "e2"}, whereClause,
+                                              [&sameAsSets, &edgesCount](const std::vector<std::string> &row) {
+            sameAsSets.unite(URIsInterner::getId(row[0]), URIsInterner::getId(row[1]));
+            edgesCount++;
+        }, capacity);
     }
 
-    // Compute canonical individuals
-    logger.info("Compute canonical individuals from owl:sameAs adjacency");
-    progressBar.restart(sameAsAdjacency.size());
-    for (const auto &adjList : sameAsAdjacency)
+    // Compute canonical individuals: one per set of at least two URIs, URIs are added in increasing order
+    logger.info("Compute canonical individuals from " + std::to_string(edgesCount) + " owl:sameAs edges");
+    m_individuals.resize(URIsInterner::size(), nullptr);
+    std::vector<std::vector<URIId>> components;
+    std::vector<unsigned int> rootToComponent(sameAsSets.getElementsCount(), 0);
+    for (URIId id = 0; id < sameAsSets.getElementsCount(); id++)
     {
-        if (m_uriToIndividual.find(adjList.first) == m_uriToIndividual.end())
+        if (sameAsSets.getSize(id) > 1)
         {
-            std::set<std::string> connectedComponent;
-            connectedComponent.insert(adjList.first);
-
-            std::set<std::string> toExpand;
-            toExpand.insert(adjList.first);
-
-            while (not toExpand.empty())
+            unsigned int &component = rootToComponent[sameAsSets.find(id)];
+            if (component == 0)
             {
-                std::set<std::string> newToExpand;
-                for (const auto &uri : toExpand)
-                {
-                    newToExpand.insert(sameAsAdjacency[uri].begin(), sameAsAdjacency[uri].end());
-                }
-
-                toExpand.clear();
-                std::set_difference(newToExpand.begin(), newToExpand.end(), connectedComponent.begin(),
-                                    connectedComponent.end(), std::inserter(toExpand, toExpand.begin()));
-                connectedComponent.insert(toExpand.begin(), toExpand.end());
+                components.emplace_back();
+                component = static_cast<unsigned int>(components.size());
             }
 
-            auto *individual = new Individual(connectedComponent);
-            for (const auto &rdfIndex : connectedComponent)
-            {
-                m_uriToIndividual[rdfIndex] = individual;
-            }
+            components[component - 1].push_back(id);
         }
+    }
 
-        ++progressBar;
+    for (auto &component : components)
+    {
+        Individual *individual = createIndividual(std::move(component));
+        for (const auto &id : individual->getURIs())
+        {
+            m_individuals[id] = individual;
+        }
     }
+
+    logger.info(std::to_string(components.size()) + " canonical individuals with several URIs");
 }
 
 IndividualsSet::~IndividualsSet()
 {
-    std::set<Individual*> toDelete;
-    for (const auto &u2i : m_uriToIndividual)
+    for (const auto &i : m_indexToIndividual)
     {
-        toDelete.insert(u2i.second);
+        delete i;
     }
+}
+
+Individual* IndividualsSet::getIndividualFromURI(const std::string &uri)
+{
+    return getIndividualFromId(URIsInterner::getId(uri));
+}
 
-    for (const auto &i : toDelete)
+Individual* IndividualsSet::getIndividualFromId(URIId id)
+{
+    if (id >= m_individuals.size())
     {
-        delete i;
+        m_individuals.resize(std::max(static_cast<unsigned long>(id) + 1, 2 * m_individuals.size()), nullptr);
+    }
+
+    if (!m_individuals[id])
+    {
+        m_individuals[id] = createIndividual(std::vector<URIId>(1, id));
     }
+
+    return m_individuals[id];
 }
 
-Individual* IndividualsSet::getIndividualFromURI(const std::string &uri)
+Individual* IndividualsSet::getIndividual(unsigned int index) const
+{
+    return m_indexToIndividual[index];
+}
+
+Individual* IndividualsSet::createIndividual(std::vector<URIId> uris)
+{
+    auto *individual = new Individual(std::move(uris), static_cast<unsigned int>(m_indexToIndividual.size()));
+    m_indexToIndividual.push_back(individual);
+    return individual;
+}
+
+void IndividualsSet::addEdge(Predicate *p, Individual *source, Individual *target)
+{
+    m_edges[p].emplace_back(source->getIndex(), target->getIndex());
+}
+
+void IndividualsSet::freeze(const Logger &logger)
+{
+    logger.info("Freeze adjacency of " + std::to_string(m_indexToIndividual.size()) + " individuals");
+    auto individualsCount = static_cast<unsigned int>(m_indexToIndividual.size());
+
+    for (auto &p2e : m_edges)
+    {
+        std::vector<std::pair<unsigned int, unsigned int>> &edges = p2e.second;
+        m_adjacency.emplace(p2e.first, Adjacency(edges, individualsCount));
+
+        for (auto &e : edges)
+        {
+            std::swap(e.first, e.second);
+        }
+
+        m_invAdjacency.emplace(p2e.first, Adjacency(edges, individualsCount));
+
+        edges.clear();
+        edges.shrink_to_fit();
+    }
+
+    m_edges.clear();
+}
+
+AdjacencyRange IndividualsSet::getNeighbours(const std::unordered_map<Predicate*, Adjacency> &adjacency, Predicate *p,
+                                             unsigned int index) const
 {
-    if (m_uriToIndividual.find(uri) == m_uriToIndividual.end())
+    auto it = adjacency.find(p);
+    if (it == adjacency.end())
     {
-        std::set<std::string> uris;
-        uris.insert(uri);
-        m_uriToIndividual[uri] = new Individual(uris);
+        return AdjacencyRange();
     }
 
-    return m_uriToIndividual[uri];
+    return it->second.getNeighbours(index);
 }
 
-std::map<Individual*, std::set<Individual*>> IndividualsSet::getAdjacency(Predicate *p)
+AdjacencyRange IndividualsSet::getAdjacentIndividuals(Predicate *p, Individual *i) const
 {
-    std::map<Individual*, std::set<Individual*>> adjacency;
+    return getNeighbours(m_adjacency, p, i->getIndex());
+}
 
-    for (const auto &u2i : m_uriToIndividual)
+std::vector<std::pair<Individual*, std::vector<Individual*>>> IndividualsSet::getAdjacency(Predicate *p) const
+{
+    // Only individuals with at least one adjacent individual
+    std::vector<std::pair<Individual*, std::vector<Individual*>>> adjacency;
+
+    auto it = m_adjacency.find(p);
+    if (it == m_adjacency.end())
     {
-        adjacency[u2i.second] = u2i.second->getAdjacentIndividuals(p);
+        return adjacency;
+    }
+
+    for (unsigned int index = 0; index < it->second.getNodesCount(); index++)
+    {
+        AdjacencyRange range(it->second.getNeighbours(index));
+        if (!range.empty())
+        {
+            adjacency.emplace_back(m_indexToIndividual[index], std::vector<Individual*>());
+            for (const auto &target : range)
+            {
+                adjacency.back().second.push_back(m_indexToIndividual[target]);
+            }
+        }
     }
 
     return adjacency;
 }
+
+Bitmap IndividualsSet::getInstances(Individual *c, Predicate *type, Predicate *subClassOf) const
+{
+    // Instances of c and of its (strict) descendants through subClassOf
+    auto individualsCount = static_cast<unsigned int>(m_indexToIndividual.size());
+    Bitmap instances(individualsCount);
+    Bitmap classes(individualsCount);
+    classes.set(c->getIndex());
+    std::vector<unsigned int> toExpand({c->getIndex()});
+
+    while (!toExpand.empty())
+    {
+        unsigned int index = toExpand.back();
+        toExpand.pop_back();
+
+        for (const auto &instance : getNeighbours(m_invAdjacency, type, index))
+        {
+            instances.set(instance);
+        }
+
+        for (const auto &subClass : getNeighbours(m_invAdjacency, subClassOf, index))
+        {
+            if (!classes.test(subClass))
+            {
+                classes.set(subClass);
+                toExpand.push_back(subClass);
+            }
+        }
+    }
+
+    return instances;
+}
+
+std::set<Individual*> IndividualsSet::getParents(Individual *i, const std::set<Predicate*> &leqPredicates,
+                                                 const std::set<Predicate*> &geqPredicates) const
+{
+    // Individuals adjacent through leq predicates and inverses of geq predicates, except i
+    std::set<Individual*> parents;
+
+    for (const auto &p : leqPredicates)
+    {
+        for (const auto &parent : getNeighbours(m_adjacency, p, i->getIndex()))
+        {
+            parents.insert(m_indexToIndividual[parent]);
+        }
+    }
+
+    for (const auto &p : geqPredicates)
+    {
+        for (const auto &parent : getNeighbours(m_invAdjacency, p, i->getIndex()))
+        {
+            parents.insert(m_indexToIndividual[parent]);
+        }
+    }
+
+    parents.erase(i);
+    return parents;
+}
@@ -5,21 +5,52 @@
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "../io/Logger.h"
-#include "../io/ServerManager.h"
+#include "../io/TriplestoreManager.h"
+#include "Adjacency.h"
+#include "Bitmap.h"
 #include "Individual.h"
+#include "Predicate.h"
 
+// Individuals and their edges: edges are buffered while they are added, then frozen in adjacency arrays per predicate
+// (forward and inverse) that are traversed by the queries on the graph
 class IndividualsSet
 {
     public:
-        IndividualsSet(const ServerManager &serverManager, const Logger &logger);
+        IndividualsSet(const TriplestoreManager &triplestoreManager, const std::set<std::string> &sameAsWhereClauses,
+                       unsigned long capacity, const Logger &logger);
+        IndividualsSet(const IndividualsSet&) = delete;
+        IndividualsSet& operator=(const IndividualsSet&) = delete;
         ~IndividualsSet();
         Individual* getIndividualFromURI(const std::string &uri);
-        std::map<Individual*, std::set<Individual*>> getAdjacency(Predicate *p);
+        Individual* getIndividualFromId(URIId id);
+        Individual* getIndividual(unsigned int index) const;
+        void addEdge(Predicate *p, Individual *source, Individual *target);
+        void freeze(const Logger &logger);
+        AdjacencyRange getAdjacentIndividuals(Predicate *p, Individual *i) const;
+        std::vector<std::pair<Individual*, std::vector<Individual*>>> getAdjacency(Predicate *p) const;
+        Bitmap getInstances(Individual *c, Predicate *type, Predicate *subClassOf) const;
+        std::set<Individual*> getParents(Individual *i, const std::set<Predicate*> &leqPredicates,
+                                         const std::set<Predicate*> &geqPredicates) const;
 
     private:
-        std::map<std::string, Individual*> m_uriToIndividual;
+        Individual* createIndividual(std::vector<URIId> uris);
+        AdjacencyRange getNeighbours(const std::unordered_map<Predicate*, Adjacency> &adjacency, Predicate *p,
+                                     unsigned int index) const;
+
+        // Individuals indexed by the identifiers of their URIs (nullptr for other URIs), and by their index
+        std::vector<Individual*> m_individuals;
+        std::vector<Individual*> m_indexToIndividual;
+
+        // Edges (source index, target index) added before the graph is frozen
+        std::unordered_map<Predicate*, std::vector<std::pair<unsigned int, unsigned int>>> m_edges;
+
+        std::unordered_map<Predicate*, Adjacency> m_adjacency;
+        std::unordered_map<Predicate*, Adjacency> m_invAdjacency;
 };
 
 
@@ -0,0 +1,19 @@
+#include "InstancesIndex.h"
+
+
+InstancesIndex::InstancesIndex(const IndividualsSet &individualsSet, Predicate *type, Predicate *subClassOf) :
+        m_individualsSet(individualsSet), m_type(type), m_subClassOf(subClassOf), m_instances()
+{
+
+}
+
+const Bitmap& InstancesIndex::getInstances(Individual *c)
+{
+    auto it = m_instances.find(c->getIndex());
+    if (it == m_instances.end())
+    {
+        it = m_instances.emplace(c->getIndex(), m_individualsSet.getInstances(c, m_type, m_subClassOf)).first;
+    }
+
+    return it->second;
+}
@@ -0,0 +1,30 @@
+#ifndef TCN3R_INSTANCESINDEX_H
+#define TCN3R_INSTANCESINDEX_H
+
+
+#include <unordered_map>
+
+#include "Bitmap.h"
+#include "Individual.h"
+#include "IndividualsSet.h"
+#include "Predicate.h"
+
+// Transitive instances of classes (instances of the class and of its descendants through subClassOf), as bitmaps
+// over the indexes of individuals. The instances of a class are computed the first time they are asked for
+class InstancesIndex
+{
+    public:
+        InstancesIndex(const IndividualsSet &individualsSet, Predicate *type, Predicate *subClassOf);
+        const Bitmap& getInstances(Individual *c);
+
+    private:
+        const IndividualsSet &m_individualsSet;
+        Predicate *m_type;
+        Predicate *m_subClassOf;
+
+        // Instances indexed by the index of their class
+        std::unordered_map<unsigned int, Bitmap> m_instances;
+};
+
+
+#endif //TCN3R_INSTANCESINDEX_H
@@ -3,16 +3,26 @@
 #include "Predicate.h"
 
 
-Predicate::Predicate(const std::string uri) : m_uri(uri), m_inverses(), m_superPredicates(), m_subPredicates()
+Predicate::Predicate(URIId uri, unsigned int index) : m_uri(uri), m_index(index), m_inverses(), m_superPredicates(), m_subPredicates()
 {
 
 }
 
 std::string Predicate::getURI() const
+{
+    return std::string(URIsInterner::getURI(m_uri));
+}
+
+URIId Predicate::getId() const
 {
     return m_uri;
 }
 
+unsigned int Predicate::getIndex() const
+{
+    return m_index;
+}
+
 void Predicate::addInverse(Predicate *inverse)
 {
     m_inverses.insert(inverse);
@@ -28,7 +38,7 @@ void Predicate::addSubPredicate(Predicate *p)
     m_subPredicates.insert(p);
 }
 
-std::set<Predicate*> Predicate::getInverses() const
+const std::set<Predicate*>& Predicate::getInverses() const
 {
     return m_inverses;
 }
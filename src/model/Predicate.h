@@ -5,20 +5,27 @@
 #include <set>
 #include <string>
 
+#include "URIsInterner.h"
+
 class Predicate
 {
     public:
-        explicit Predicate(std::string uri);
+        Predicate(URIId uri, unsigned int index);
         std::string getURI() const;
+        URIId getId() const;
+        unsigned int getIndex() const;
         void addInverse(Predicate *inverse);
         void addSuperPredicate(Predicate *p);
         void addSubPredicate(Predicate *p);
-        std::set<Predicate*> getInverses() const;
+        const std::set<Predicate*>& getInverses() const;
         std::set<Predicate*> getDescendants();
         std::set<Predicate*> getAncestors();
 
     private:
-        const std::string m_uri;
+        const URIId m_uri;
+
+        // Dense identifier of the predicate in its PredicatesSet
+        const unsigned int m_index;
         std::set<Predicate*> m_inverses;
         std::set<Predicate*> m_superPredicates;
         std::set<Predicate*> m_subPredicates;
@@ -1,19 +1,48 @@
 #include "PredicatesSet.h"
 
 
-PredicatesSet::PredicatesSet(const ServerManager &serverManager, const Logger &logger) : m_predicates()
+PredicatesSet::PredicatesSet() : m_predicates(), m_indexToPredicate(), m_ancestors(), m_descendants(), m_impliedEdges()
 {
-    // Query all predicates
-    logger.info("Query all predicates");
-    std::set<std::string> predicateUris = serverManager.queryElements("[] ?e [] .");
-    for (const auto &uri : predicateUris)
+
+}
+
+PredicatesSet::PredicatesSet(const TriplestoreManager &triplestoreManager, const Configuration &parameters,
+                             const Logger &logger) : m_predicates(), m_indexToPredicate(), m_ancestors(),
+                                                     m_descendants(), m_impliedEdges()
+{
+    std::set<std::pair<std::string, std::string>> inverseOfEdges;
+    std::set<std::string> symmetricPredicates;
+    std::set<std::pair<std::string, std::string>> subPropertyOfEdges;
+
+    if (parameters.getPredicateDiscovery() == TARGETED_DISCOVERY)
     {
-        m_predicates[uri] = new Predicate(uri);
+        // Only predicates connected to the ones of the configuration are discovered
+        logger.info("Discover predicates connected to the configuration");
+        discoverPredicates(triplestoreManager, parameters, inverseOfEdges, symmetricPredicates, subPropertyOfEdges);
     }
 
-    // Query inverse predicates
-    logger.info("Query owl:inverseOf edges");
-    std::set<std::pair<std::string, std::string>> inverseOfEdges = serverManager.queryTwoElements("?e1 owl:inverseOf ?e2");
+    else
+    {
+        // Query all predicates
+        logger.info("Query all predicates");
+        std::set<std::string> predicateUris = triplestoreManager.queryElements("[] ?e [] .");
+        for (const auto &uri : predicateUris)
+        {
+            getPredicateFromUri(uri);
+        }
+
+        // Query inverse predicates
+        logger.info("Query owl:inverseOf edges");
+        inverseOfEdges = triplestoreManager.queryTwoElements("?e1 owl:inverseOf ?e2");
+
+        // Query symmetric predicates
+        logger.info("Query symmetric predicates");
+        symmetricPredicates = triplestoreManager.queryElements("?e rdf:type owl:SymmetricProperty");
+
+        // Query owl:subPropertyOf edges
+        logger.info("Query rdfs:subPropertyOf edges");
+        subPropertyOfEdges = triplestoreManager.queryTwoElements("?e1 rdfs:subPropertyOf ?e2");
+    }
 
     logger.info("Add inverses for predicates");
     for (const auto &e : inverseOfEdges)
@@ -25,10 +54,6 @@ PredicatesSet::PredicatesSet(const ServerManager &serverManager, const Logger &l
         p2->addInverse(p1);
     }
 
-    // Query symmetric predicates
-    logger.info("Query symmetric predicates");
-    std::set<std::string> symmetricPredicates = serverManager.queryElements("?e rdf:type owl:SymmetricProperty");
-
     logger.info("Add symmetry for predicates");
     for (const auto &uri : symmetricPredicates)
     {
@@ -36,10 +61,6 @@ PredicatesSet::PredicatesSet(const ServerManager &serverManager, const Logger &l
         p->addInverse(p);
     }
 
-    // Query owl:subPropertyOf edges
-    logger.info("Query rdfs:subPropertyOf edges");
-    std::set<std::pair<std::string, std::string>> subPropertyOfEdges = serverManager.queryTwoElements("?e1 rdfs:subPropertyOf ?e2");
-
     logger.info("Build hierarchy of predicates");
     for (const auto &e : subPropertyOfEdges)
     {
@@ -49,28 +70,146 @@ PredicatesSet::PredicatesSet(const ServerManager &serverManager, const Logger &l
         p1->addSuperPredicate(p2);
         p2->addSubPredicate(p1);
     }
+
+    logger.info("Compute closures of the hierarchy of predicates");
+    computeClosures();
 }
 
 PredicatesSet::~PredicatesSet()
 {
-    std::set<Predicate*> toDelete;
-    for (const auto &u2p : m_predicates)
+    for (const auto &p : m_indexToPredicate)
     {
-        toDelete.insert(u2p.second);
+        delete p;
     }
+}
+
+Predicate* PredicatesSet::getPredicateFromUri(const std::string &uri)
+{
+    URIId id = URIsInterner::getId(uri);
 
-    for (const auto &p : toDelete)
+    auto it = m_predicates.find(id);
+    if (it == m_predicates.end())
     {
-        delete p;
+        auto *p = new Predicate(id, static_cast<unsigned int>(m_indexToPredicate.size()));
+        it = m_predicates.emplace(id, p).first;
+        m_indexToPredicate.push_back(p);
+
+        // A new predicate is not in the hierarchy yet, closures are computed again once the hierarchy is built
+        addClosures(p);
     }
+
+    return it->second;
 }
 
-Predicate* PredicatesSet::getPredicateFromUri(const std::string &uri)
+const std::vector<Predicate*>& PredicatesSet::getAncestors(Predicate *p) const
+{
+    return m_ancestors[p->getIndex()];
+}
+
+const std::vector<Predicate*>& PredicatesSet::getDescendants(Predicate *p) const
+{
+    return m_descendants[p->getIndex()];
+}
+
+const std::vector<ImpliedEdge>& PredicatesSet::getImpliedEdges(Predicate *p) const
+{
+    return m_impliedEdges[p->getIndex()];
+}
+
+void PredicatesSet::computeClosures()
+{
+    m_ancestors.clear();
+    m_descendants.clear();
+    m_impliedEdges.clear();
+
+    for (const auto &p : m_indexToPredicate)
+    {
+        addClosures(p);
+    }
+}
+
+void PredicatesSet::addClosures(Predicate *p)
 {
-    if (m_predicates.find(uri) == m_predicates.end())
+    std::set<Predicate*> ancestors(p->getAncestors());
+    std::set<Predicate*> descendants(p->getDescendants());
+    m_ancestors.emplace_back(ancestors.begin(), ancestors.end());
+    m_descendants.emplace_back(descendants.begin(), descendants.end());
+
+    // An edge implies the reversed edges of the inverses of the predicate, and the edges of its ancestors (and the
+    // reversed edges of their inverses)
+    std::set<ImpliedEdge> impliedEdges;
+    impliedEdges.emplace(p, false);
+
+    for (const auto &pInv : p->getInverses())
     {
-        m_predicates[uri] = new Predicate(uri);
+        impliedEdges.emplace(pInv, true);
     }
 
-    return m_predicates[uri];
+    for (const auto &pAncestor : ancestors)
+    {
+        impliedEdges.emplace(pAncestor, false);
+
+        for (const auto &pAncestorInv : pAncestor->getInverses())
+        {
+            impliedEdges.emplace(pAncestorInv, true);
+        }
+    }
+
+    m_impliedEdges.emplace_back(impliedEdges.begin(), impliedEdges.end());
+}
+
+void PredicatesSet::discoverPredicates(const TriplestoreManager &triplestoreManager, const Configuration &parameters,
+                                       std::set<std::pair<std::string, std::string>> &inverseOfEdges,
+                                       std::set<std::string> &symmetricPredicates,
+                                       std::set<std::pair<std::string, std::string>> &subPropertyOfEdges)
+{
+    // Predicates of the configuration and predicates used to detect instances
+    std::set<std::string> known(parameters.getPredicatesInDimensions());
+    known.insert("http://www.w3.org/1999/02/22-rdf-syntax-ns#type");
+    known.insert("http://www.w3.org/2000/01/rdf-schema#subClassOf");
+
+    // Expand the connected component of rdfs:subPropertyOf and owl:inverseOf edges around them, one level at a time:
+    // the cost depends on the size of the schema, not on the size of the store
+    std::set<std::string> toExpand(known);
+    while (!toExpand.empty())
+    {
+        std::string values(" {");
+        for (const auto &uri : toExpand)
+        {
+            values += " <" + uri + ">";
+        }
+
+        values += " }";
+
+        std::set<std::pair<std::string, std::string>> edges;
+        auto queryLevel = [&triplestoreManager, &values, &edges](const std::string &edgePattern,
+                                                                 std::set<std::pair<std::string, std::string>> &discoveredEdges) {
+            for (const auto &variable : {"?e1", "?e2"})
+            {
+                std::set<std::pair<std::string, std::string>> levelEdges =
+                        triplestoreManager.queryTwoElements(edgePattern + " VALUES " + variable + values);
+                discoveredEdges.insert(levelEdges.begin(), levelEdges.end());
+                edges.insert(levelEdges.begin(), levelEdges.end());
+            }
+        };
+
+        queryLevel("?e1 owl:inverseOf ?e2", inverseOfEdges);
+        queryLevel("?e1 rdfs:subPropertyOf ?e2", subPropertyOfEdges);
+
+        std::set<std::string> symmetric = triplestoreManager.queryElements("?e rdf:type owl:SymmetricProperty VALUES ?e" + values);
+        symmetricPredicates.insert(symmetric.begin(), symmetric.end());
+
+        // Blank nodes (e.g., anonymous inverse properties) cannot be given in queries, IRIs always contain a scheme
+        toExpand.clear();
+        for (const auto &e : edges)
+        {
+            for (const auto &uri : {e.first, e.second})
+            {
+                if (uri.find(':') != std::string::npos && known.insert(uri).second)
+                {
+                    toExpand.insert(uri);
+                }
+            }
+        }
+    }
 }
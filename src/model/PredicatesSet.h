@@ -3,21 +3,46 @@
 
 
 #include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "../configuration/Configuration.h"
 #include "../io/Logger.h"
-#include "../io/ServerManager.h"
+#include "../io/TriplestoreManager.h"
 #include "Predicate.h"
 
+// Edge implied by an edge of a predicate: an edge of the given predicate, reversed if the boolean is true
+typedef std::pair<Predicate*, bool> ImpliedEdge;
+
 class PredicatesSet
 {
     public:
-        PredicatesSet(const ServerManager &serverManager, const Logger &logger);
+        PredicatesSet();
+        PredicatesSet(const TriplestoreManager &triplestoreManager, const Configuration &parameters, const Logger &logger);
         ~PredicatesSet();
         Predicate* getPredicateFromUri(const std::string &uri);
+        const std::vector<Predicate*>& getAncestors(Predicate *p) const;
+        const std::vector<Predicate*>& getDescendants(Predicate *p) const;
+        const std::vector<ImpliedEdge>& getImpliedEdges(Predicate *p) const;
 
     private:
-        std::map<std::string, Predicate*> m_predicates;
+        static void discoverPredicates(const TriplestoreManager &triplestoreManager, const Configuration &parameters,
+                                       std::set<std::pair<std::string, std::string>> &inverseOfEdges,
+                                       std::set<std::string> &symmetricPredicates,
+                                       std::set<std::pair<std::string, std::string>> &subPropertyOfEdges);
+        void computeClosures();
+        void addClosures(Predicate *p);
+
+        std::unordered_map<URIId, Predicate*> m_predicates;
+        std::vector<Predicate*> m_indexToPredicate;
+
+        // Closures of the hierarchy of predicates and edges implied by an edge, indexed by predicate
+        std::vector<std::vector<Predicate*>> m_ancestors;
+        std::vector<std::vector<Predicate*>> m_descendants;
+        std::vector<std::vector<ImpliedEdge>> m_impliedEdges;
 };
 
 
@@ -0,0 +1,245 @@
+#include <algorithm>
+#include <limits>
+
+#include "ReachabilityIndex.h"
+
+
+ReachabilityIndex::ReachabilityIndex() : m_components(), m_dag(), m_pre(), m_last(), m_post(), m_low()
+{
+
+}
+
+ReachabilityIndex::ReachabilityIndex(std::vector<std::pair<unsigned int, unsigned int>> &edges, unsigned int nodesCount) :
+        m_components(nodesCount, 0), m_dag(), m_pre(), m_last(), m_post(), m_low()
+{
+    Adjacency graph(edges, nodesCount);
+    unsigned int componentsCount = computeComponents(graph);
+
+    std::vector<std::pair<unsigned int, unsigned int>> dagEdges;
+    for (unsigned int node = 0; node < nodesCount; node++)
+    {
+        for (const auto &neighbour : graph.getNeighbours(node))
+        {
+            if (m_components[node] != m_components[neighbour])
+            {
+                dagEdges.emplace_back(m_components[node], m_components[neighbour]);
+            }
+        }
+    }
+
+    m_dag = Adjacency(dagEdges, componentsCount);
+    computeLabels();
+}
+
+unsigned int ReachabilityIndex::computeComponents(const Adjacency &graph)
+{
+    // Iterative Tarjan's algorithm: a component is numbered once all the components it reaches are numbered
+    const unsigned int unvisited = std::numeric_limits<unsigned int>::max();
+    unsigned int nodesCount = graph.getNodesCount();
+    std::vector<unsigned int> order(nodesCount, unvisited);
+    std::vector<unsigned int> low(nodesCount, 0);
+    std::vector<bool> onStack(nodesCount, false);
+    std::vector<unsigned int> componentStack;
+    std::vector<std::pair<unsigned int, const unsigned int*>> callStack;
+    unsigned int visitedCount(0);
+    unsigned int componentsCount(0);
+
+    auto visit = [&](unsigned int node) {
+        order[node] = low[node] = visitedCount++;
+        componentStack.push_back(node);
+        onStack[node] = true;
+        callStack.emplace_back(node, graph.getNeighbours(node).begin());
+    };
+
+    for (unsigned int root = 0; root < nodesCount; root++)
+    {
+        if (order[root] != unvisited)
+        {
+            continue;
+        }
+
+        visit(root);
+        while (!callStack.empty())
+        {
+            unsigned int node = callStack.back().first;
+
+            if (callStack.back().second != graph.getNeighbours(node).end())
+            {
+                unsigned int neighbour = *(callStack.back().second++);
+
+                if (order[neighbour] == unvisited)
+                {
+                    visit(neighbour);
+                }
+
+                else if (onStack[neighbour])
+                {
+                    low[node] = std::min(low[node], order[neighbour]);
+                }
+
+                continue;
+            }
+
+            callStack.pop_back();
+            if (!callStack.empty())
+            {
+                unsigned int parent = callStack.back().first;
+                low[parent] = std::min(low[parent], low[node]);
+            }
+
+            if (low[node] == order[node])
+            {
+                unsigned int member;
+                do
+                {
+                    member = componentStack.back();
+                    componentStack.pop_back();
+                    onStack[member] = false;
+                    m_components[member] = componentsCount;
+                }
+                while (member != node);
+
+                componentsCount++;
+            }
+        }
+    }
+
+    return componentsCount;
+}
+
+void ReachabilityIndex::computeLabels()
+{
+    // Iterative depth-first search of the DAG: the descendants of a component are all numbered when it is left
+    const unsigned int unvisited = std::numeric_limits<unsigned int>::max();
+    unsigned int componentsCount = m_dag.getNodesCount();
+    m_pre.assign(componentsCount, unvisited);
+    m_last.assign(componentsCount, 0);
+    m_post.assign(componentsCount, 0);
+    m_low.assign(componentsCount, 0);
+    std::vector<std::pair<unsigned int, const unsigned int*>> callStack;
+    unsigned int preCount(0);
+    unsigned int postCount(0);
+
+    for (unsigned int root = 0; root < componentsCount; root++)
+    {
+        if (m_pre[root] != unvisited)
+        {
+            continue;
+        }
+
+        m_pre[root] = preCount++;
+        callStack.emplace_back(root, m_dag.getNeighbours(root).begin());
+
+        while (!callStack.empty())
+        {
+            unsigned int c = callStack.back().first;
+
+            if (callStack.back().second != m_dag.getNeighbours(c).end())
+            {
+                unsigned int d = *(callStack.back().second++);
+
+                if (m_pre[d] == unvisited)
+                {
+                    m_pre[d] = preCount++;
+                    callStack.emplace_back(d, m_dag.getNeighbours(d).begin());
+                }
+
+                continue;
+            }
+
+            callStack.pop_back();
+            m_last[c] = preCount - 1;
+            m_post[c] = postCount++;
+            m_low[c] = m_post[c];
+
+            for (const auto &d : m_dag.getNeighbours(c))
+            {
+                m_low[c] = std::min(m_low[c], m_low[d]);
+            }
+        }
+    }
+}
+
+bool ReachabilityIndex::isTreeDescendant(unsigned int c, unsigned int d) const
+{
+    return m_pre[c] <= m_pre[d] && m_pre[d] <= m_last[c];
+}
+
+bool ReachabilityIndex::mayReach(unsigned int c, unsigned int d) const
+{
+    return c >= d && m_post[d] <= m_post[c] && m_low[c] <= m_low[d];
+}
+
+bool ReachabilityIndex::reaches(unsigned int source, unsigned int target) const
+{
+    // Nodes outside of the graph only reach themselves
+    if (source >= m_components.size() || target >= m_components.size())
+    {
+        return source == target;
+    }
+
+    unsigned int c = m_components[source];
+    unsigned int d = m_components[target];
+
+    if (isTreeDescendant(c, d))
+    {
+        return true;
+    }
+
+    if (!mayReach(c, d))
+    {
+        return false;
+    }
+
+    SearchBuffer &buffer = getSearchBuffer();
+    if (buffer.visited.size() < m_pre.size())
+    {
+        buffer.visited.resize(m_pre.size(), 0);
+    }
+
+    // Marks of previous queries are cleared when their numbers wrap around
+    if (++buffer.query == 0)
+    {
+        std::fill(buffer.visited.begin(), buffer.visited.end(), 0);
+        buffer.query = 1;
+    }
+
+    std::vector<unsigned int> &toExpand = buffer.toExpand;
+    toExpand.clear();
+    toExpand.push_back(c);
+    buffer.visited[c] = buffer.query;
+
+    while (!toExpand.empty())
+    {
+        unsigned int current = toExpand.back();
+        toExpand.pop_back();
+
+        for (const auto &next : m_dag.getNeighbours(current))
+        {
+            if (buffer.visited[next] == buffer.query)
+            {
+                continue;
+            }
+
+            buffer.visited[next] = buffer.query;
+            if (mayReach(next, d))
+            {
+                if (isTreeDescendant(next, d))
+                {
+                    return true;
+                }
+
+                toExpand.push_back(next);
+            }
+        }
+    }
+
+    return false;
+}
+
+ReachabilityIndex::SearchBuffer& ReachabilityIndex::getSearchBuffer()
+{
+    // Queries run in the threads of the batch reconciliation
+    thread_local SearchBuffer buffer;
+    return buffer;
+}
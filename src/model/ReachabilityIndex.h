@@ -0,0 +1,52 @@
+#ifndef TCN3R_REACHABILITYINDEX_H
+#define TCN3R_REACHABILITYINDEX_H
+
+
+#include <utility>
+#include <vector>
+
+#include "Adjacency.h"
+
+// Reachability in a directed graph over dense node identifiers, in memory linear in the size of the graph. Strongly
+// connected components are condensed in a DAG whose nodes get a depth-first spanning tree interval (positive cut) and
+// an interval over the post-order numbers of all their descendants (negative cut). Queries that neither cut answers
+// fall back to a depth-first search of the DAG pruned by both cuts
+class ReachabilityIndex
+{
+    public:
+        ReachabilityIndex();
+        ReachabilityIndex(std::vector<std::pair<unsigned int, unsigned int>> &edges, unsigned int nodesCount);
+        bool reaches(unsigned int source, unsigned int target) const;
+
+    private:
+        unsigned int computeComponents(const Adjacency &graph);
+        void computeLabels();
+        bool isTreeDescendant(unsigned int c, unsigned int d) const;
+        bool mayReach(unsigned int c, unsigned int d) const;
+
+        // State of the fallback search, reused by all the queries of a thread: visited components are marked with the
+        // number of the query, so that nothing is allocated nor cleared between queries
+        struct SearchBuffer
+        {
+            std::vector<unsigned int> visited;
+            std::vector<unsigned int> toExpand;
+            unsigned int query = 0;
+        };
+
+        static SearchBuffer& getSearchBuffer();
+
+        // Component of each node: components are numbered in reverse topological order (a component only reaches
+        // components with smaller numbers)
+        std::vector<unsigned int> m_components;
+        Adjacency m_dag;
+
+        // Pre-order number, greatest pre-order number in the spanning subtree, post-order number and smallest
+        // post-order number of the descendants of each component
+        std::vector<unsigned int> m_pre;
+        std::vector<unsigned int> m_last;
+        std::vector<unsigned int> m_post;
+        std::vector<unsigned int> m_low;
+};
+
+
+#endif //TCN3R_REACHABILITYINDEX_H
@@ -1,12 +1,19 @@
+#include <algorithm>
+#include <utility>
+
 #include "Relation.h"
 
 
 Relation::Relation(Individual *relInd, std::map<Individual*, RelationElement*> &indToEl,
-                   const std::map<std::string, std::set<Individual*>> &dimensionInstances, IndividualsSet &individualsSet,
-                   PredicatesSet &predicatesSet, const Configuration &parameters) : m_uris(relInd->getURIs()), m_dimensions()
+                   const std::map<std::string, Bitmap> &dimensionInstances, IndividualsSet &individualsSet,
+                   PredicatesSet &predicatesSet, const Configuration &parameters) : m_uris(relInd->getURIs()), m_dimensions(),
+                                                                                    m_signature(), m_dimensionSets(),
+                                                                                    m_aggregatedDimensionSets()
 {
     for (const auto &d : parameters.getDimensions())
     {
+        const Bitmap &instances = dimensionInstances.at(d.first);
+
         // Detect all predicates associated with this dimension
         std::set<Predicate*> dimensionPredicates;
         for (const auto &predUri : d.second.getRelToIndPredicates())
@@ -14,7 +21,7 @@ Relation::Relation(Individual *relInd, std::map<Individual*, RelationElement*> &
             Predicate *p = predicatesSet.getPredicateFromUri(predUri);
             dimensionPredicates.insert(p);
 
-            for (const auto &pDescendant : p->getDescendants())
+            for (const auto &pDescendant : predicatesSet.getDescendants(p))
             {
                 dimensionPredicates.insert(pDescendant);
             }
@@ -25,23 +32,43 @@ Relation::Relation(Individual *relInd, std::map<Individual*, RelationElement*> &
             std::pair<std::string, Predicate*> dimKey(d.first, p);
             m_dimensions[dimKey].clear();
 
-            for (const auto &i : relInd->getAdjacentIndividuals(p))
+            for (const auto &index : individualsSet.getAdjacentIndividuals(p, relInd))
             {
-                if (dimensionInstances.at(d.first).find(i) != dimensionInstances.at(d.first).end())
+                if (instances.test(index))
                 {
-                    m_dimensions[dimKey].insert(RelationElement::getRelationElementFromIndividual(indToEl, i));
+                    m_dimensions[dimKey].insert(RelationElement::getRelationElementFromIndividual(indToEl,
+                                                                    individualsSet.getIndividual(index)));
                 }
             }
         }
     }
 }
 
-std::set<std::string> Relation::getURIs() const
+Relation::Relation(std::vector<URIId> uris, std::map<std::pair<std::string, Predicate*>, std::set<RelationElement*>> dimensions) :
+        m_uris(std::move(uris)), m_dimensions(std::move(dimensions)), m_signature(), m_dimensionSets(),
+        m_aggregatedDimensionSets()
+{
+
+}
+
+const std::vector<URIId>& Relation::getURIs() const
 {
     return m_uris;
 }
 
-std::map<std::pair<std::string, Predicate*>, std::set<RelationElement*>> Relation::getDimensions() const
+std::string Relation::getURI() const
+{
+    // The relation is identified by the smallest of its URIs in the output
+    std::string_view uri(URIsInterner::getURI(m_uris.front()));
+    for (const auto &id : m_uris)
+    {
+        uri = std::min(uri, URIsInterner::getURI(id));
+    }
+
+    return std::string(uri);
+}
+
+const std::map<std::pair<std::string, Predicate*>, std::set<RelationElement*>>& Relation::getDimensions() const
 {
     return m_dimensions;
 }
@@ -82,10 +109,36 @@ std::map<std::string, std::set<RelationElement*>> Relation::getAggregatedDimensi
     return aggregatedDimensions;
 }
 
+const RelationSignature& Relation::getSignature() const
+{
+    return m_signature;
+}
+
+void Relation::setSignature(RelationSignature signature)
+{
+    m_signature = std::move(signature);
+}
+
+const std::vector<unsigned int>& Relation::getDimensionSets() const
+{
+    return m_dimensionSets;
+}
+
+const std::vector<unsigned int>& Relation::getAggregatedDimensionSets() const
+{
+    return m_aggregatedDimensionSets;
+}
+
+void Relation::setDimensionSets(std::vector<unsigned int> dimensionSets, std::vector<unsigned int> aggregatedDimensionSets)
+{
+    m_dimensionSets = std::move(dimensionSets);
+    m_aggregatedDimensionSets = std::move(aggregatedDimensionSets);
+}
+
 std::string Relation::toString() const
 {
     std::string retVal("Relation URIs = [ ");
-    for (const auto &uri : m_uris)
+    for (const auto &uri : URIsInterner::getURIs(m_uris))
     {
         retVal += uri + " ";
     }
@@ -5,27 +5,43 @@
 #include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "../configuration/Configuration.h"
+#include "Bitmap.h"
 #include "Individual.h"
 #include "IndividualsSet.h"
 #include "PredicatesSet.h"
 #include "RelationElement.h"
+#include "Signature.h"
+#include "URIsInterner.h"
 
 class Relation
 {
     public:
         Relation(Individual *relInd, std::map<Individual*, RelationElement*> &indToEl,
-                 const std::map<std::string, std::set<Individual*>> &dimensionInstances, IndividualsSet &individualsSet,
+                 const std::map<std::string, Bitmap> &dimensionInstances, IndividualsSet &individualsSet,
                  PredicatesSet &predicatesSet, const Configuration &parameters);
-        std::set<std::string> getURIs() const;
-        std::map<std::pair<std::string, Predicate*>, std::set<RelationElement*>> getDimensions() const;
+        Relation(std::vector<URIId> uris, std::map<std::pair<std::string, Predicate*>, std::set<RelationElement*>> dimensions);
+        const std::vector<URIId>& getURIs() const;
+        std::string getURI() const;
+        const std::map<std::pair<std::string, Predicate*>, std::set<RelationElement*>>& getDimensions() const;
         std::map<std::string, std::set<RelationElement*>> getAggregatedDimensions() const;
+        const RelationSignature& getSignature() const;
+        void setSignature(RelationSignature signature);
+        const std::vector<unsigned int>& getDimensionSets() const;
+        const std::vector<unsigned int>& getAggregatedDimensionSets() const;
+        void setDimensionSets(std::vector<unsigned int> dimensionSets, std::vector<unsigned int> aggregatedDimensionSets);
         std::string toString() const;
 
     private:
-        const std::set<std::string> m_uris;
+        const std::vector<URIId> m_uris;
         std::map<std::pair<std::string, Predicate*>, std::set<RelationElement*>> m_dimensions;
+        RelationSignature m_signature;
+
+        // Interned dimensions (in the order of the keys) and aggregated dimensions (in the order of the preorders)
+        std::vector<unsigned int> m_dimensionSets;
+        std::vector<unsigned int> m_aggregatedDimensionSets;
 };
 
 
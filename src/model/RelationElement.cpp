@@ -3,7 +3,7 @@
 #include "RelationElement.h"
 
 
-RelationElement::RelationElement(std::set<std::string> uris) : m_uris(std::move(uris)), m_dependencies(), m_inDimensions()
+RelationElement::RelationElement(std::vector<URIId> uris) : m_uris(std::move(uris)), m_dependencies(), m_inDimensions()
 {
 
 }
@@ -12,7 +12,7 @@ std::string RelationElement::toString() const
 {
     std::string retVal("RelationElement = [ ");
 
-    for (const auto &uri : m_uris)
+    for (const auto &uri : URIsInterner::getURIs(m_uris))
     {
         retVal += uri + " ";
     }
@@ -22,6 +22,11 @@ std::string RelationElement::toString() const
     return retVal;
 }
 
+const std::vector<URIId>& RelationElement::getURIs() const
+{
+    return m_uris;
+}
+
 RelationElement* RelationElement::getRelationElementFromIndividual(std::map<Individual *, RelationElement *> &indToEl, Individual *i)
 {
     if (indToEl.find(i) == indToEl.end())
@@ -47,6 +52,11 @@ std::set<RelationElement*> RelationElement::getDependencies(const std::string &d
     return m_dependencies.at(dimensionName);
 }
 
+std::map<std::string, std::set<RelationElement*>> RelationElement::getDependencies() const
+{
+    return m_dependencies;
+}
+
 void RelationElement::addInDimension(const std::string &dimensionName)
 {
     m_inDimensions.insert(dimensionName);
@@ -2,24 +2,30 @@
 #define TCN3R_RELATIONELEMENT_H
 
 
+#include <map>
 #include <set>
 #include <string>
+#include <vector>
+
 #include "Individual.h"
+#include "URIsInterner.h"
 
 class RelationElement
 {
     public:
         static RelationElement* getRelationElementFromIndividual(std::map<Individual*, RelationElement*> &indToEl, Individual *i);
 
-        explicit RelationElement(std::set<std::string> uris);
+        explicit RelationElement(std::vector<URIId> uris);
         std::string toString() const;
+        const std::vector<URIId>& getURIs() const;
         void addDependency(const std::string &dimensionName, RelationElement *dependency);
         std::set<RelationElement*> getDependencies(const std::string &dimensionName) const;
+        std::map<std::string, std::set<RelationElement*>> getDependencies() const;
         void addInDimension(const std::string &dimensionName);
         std::set<std::string> getInDimensions() const;
 
     private:
-        const std::set<std::string> m_uris;
+        const std::vector<URIId> m_uris;
         std::map<std::string, std::set<RelationElement*>> m_dependencies;
         std::set<std::string> m_inDimensions;
 };
@@ -0,0 +1,160 @@
+#include <utility>
+
+#include "Signature.h"
+
+
+Signature::Signature() : m_words()
+{
+
+}
+
+void Signature::add(const void *element)
+{
+    // Two bits from a 64-bit mix of the address (splitmix64 finalizer)
+    auto hash = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(element));
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+    hash ^= hash >> 31;
+
+    unsigned int bit1 = static_cast<unsigned int>(hash) % (SIGNATURE_WORDS * 64);
+    unsigned int bit2 = static_cast<unsigned int>(hash >> 32) % (SIGNATURE_WORDS * 64);
+    m_words[bit1 / 64] |= std::uint64_t(1) << (bit1 % 64);
+    m_words[bit2 / 64] |= std::uint64_t(1) << (bit2 % 64);
+}
+
+void Signature::unite(const Signature &other)
+{
+    for (unsigned int w = 0; w < SIGNATURE_WORDS; w++)
+    {
+        m_words[w] |= other.m_words[w];
+    }
+}
+
+bool Signature::mayBeSubsetOf(const Signature &other) const
+{
+    std::uint64_t extra(0);
+    for (unsigned int w = 0; w < SIGNATURE_WORDS; w++)
+    {
+        extra |= m_words[w] & ~other.m_words[w];
+    }
+
+    return extra == 0;
+}
+
+bool Signature::mayIntersect(const Signature &other) const
+{
+    std::uint64_t common(0);
+    for (unsigned int w = 0; w < SIGNATURE_WORDS; w++)
+    {
+        common |= m_words[w] & other.m_words[w];
+    }
+
+    return common != 0;
+}
+
+RelationSignature::RelationSignature() : m_dimensions(), m_nonEmpty(), m_aggregatedDimensions(), m_aggregatedNonEmpty()
+{
+
+}
+
+RelationSignature::RelationSignature(std::vector<DimensionSignature> dimensions, std::vector<std::uint64_t> nonEmpty,
+                                     std::vector<DimensionSignature> aggregatedDimensions,
+                                     std::vector<std::uint64_t> aggregatedNonEmpty) :
+        m_dimensions(std::move(dimensions)), m_nonEmpty(std::move(nonEmpty)),
+        m_aggregatedDimensions(std::move(aggregatedDimensions)), m_aggregatedNonEmpty(std::move(aggregatedNonEmpty))
+{
+
+}
+
+bool RelationSignature::mayBeComparable(const RelationSignature &other) const
+{
+    if (m_nonEmpty.empty() || m_nonEmpty.size() != other.m_nonEmpty.size())
+    {
+        return true;
+    }
+
+    // Dimensions only non-empty for one relation are LEQ, dimensions only non-empty for the other one are GEQ: the
+    // result would be COMPARABLE with empty dimensions, which is INCOMPARABLE
+    std::uint64_t onlyNonEmpty1(0), onlyNonEmpty2(0);
+    for (unsigned long w = 0; w < m_nonEmpty.size(); w++)
+    {
+        onlyNonEmpty1 |= m_nonEmpty[w] & ~other.m_nonEmpty[w];
+        onlyNonEmpty2 |= other.m_nonEmpty[w] & ~m_nonEmpty[w];
+    }
+
+    if (onlyNonEmpty1 != 0 && onlyNonEmpty2 != 0)
+    {
+        return false;
+    }
+
+    // Dimensions non-empty for both relations have to be LEQ or GEQ (signatures are found from the ranks of their
+    // bits in the masks)
+    unsigned long rank1(0), rank2(0);
+    for (unsigned long w = 0; w < m_nonEmpty.size(); w++)
+    {
+        std::uint64_t bothNonEmpty = m_nonEmpty[w] & other.m_nonEmpty[w];
+        while (bothNonEmpty != 0)
+        {
+            std::uint64_t below = (bothNonEmpty & -bothNonEmpty) - 1;
+            const DimensionSignature &dim1 = m_dimensions[rank1 + __builtin_popcountll(m_nonEmpty[w] & below)];
+            const DimensionSignature &dim2 = other.m_dimensions[rank2 + __builtin_popcountll(other.m_nonEmpty[w] & below)];
+            if (!dim1.elements.mayBeSubsetOf(dim2.downSet) && !dim2.elements.mayBeSubsetOf(dim1.downSet))
+            {
+                return false;
+            }
+
+            bothNonEmpty &= bothNonEmpty - 1;
+        }
+
+        rank1 += __builtin_popcountll(m_nonEmpty[w]);
+        rank2 += __builtin_popcountll(other.m_nonEmpty[w]);
+    }
+
+    return true;
+}
+
+bool RelationSignature::mayBeRelated(const RelationSignature &other, int nonEmptyDimensionLimit) const
+{
+    if (m_aggregatedNonEmpty.empty() || m_aggregatedNonEmpty.size() != other.m_aggregatedNonEmpty.size())
+    {
+        return true;
+    }
+
+    // Enough aggregated dimensions non-empty for both relations, one of them with comparable elements (otherwise its
+    // similarity is at most 0)
+    int bothNonEmptyCount(0);
+    for (unsigned long w = 0; w < m_aggregatedNonEmpty.size(); w++)
+    {
+        bothNonEmptyCount += __builtin_popcountll(m_aggregatedNonEmpty[w] & other.m_aggregatedNonEmpty[w]);
+    }
+
+    if (bothNonEmptyCount < nonEmptyDimensionLimit)
+    {
+        return false;
+    }
+
+    unsigned long rank1(0), rank2(0);
+    for (unsigned long w = 0; w < m_aggregatedNonEmpty.size(); w++)
+    {
+        std::uint64_t bothNonEmpty = m_aggregatedNonEmpty[w] & other.m_aggregatedNonEmpty[w];
+        while (bothNonEmpty != 0)
+        {
+            std::uint64_t below = (bothNonEmpty & -bothNonEmpty) - 1;
+            const DimensionSignature &dim1 =
+                    m_aggregatedDimensions[rank1 + __builtin_popcountll(m_aggregatedNonEmpty[w] & below)];
+            const DimensionSignature &dim2 =
+                    other.m_aggregatedDimensions[rank2 + __builtin_popcountll(other.m_aggregatedNonEmpty[w] & below)];
+            if (dim1.elements.mayIntersect(dim2.downSet) || dim2.elements.mayIntersect(dim1.downSet))
+            {
+                return true;
+            }
+
+            bothNonEmpty &= bothNonEmpty - 1;
+        }
+
+        rank1 += __builtin_popcountll(m_aggregatedNonEmpty[w]);
+        rank2 += __builtin_popcountll(other.m_aggregatedNonEmpty[w]);
+    }
+
+    return false;
+}
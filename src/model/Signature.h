@@ -0,0 +1,55 @@
+#ifndef TCN3R_SIGNATURE_H
+#define TCN3R_SIGNATURE_H
+
+
+#include <cstdint>
+#include <vector>
+
+// Number of 64-bit words of a signature
+#define SIGNATURE_WORDS 4
+
+// Bloom filter of the elements of a set (two bits per element): a set can only be included in another set (or
+// intersect it) if its bits are included in the bits of the other set (or intersect them)
+class Signature
+{
+    public:
+        Signature();
+        void add(const void *element);
+        void unite(const Signature &other);
+        bool mayBeSubsetOf(const Signature &other) const;
+        bool mayIntersect(const Signature &other) const;
+
+    private:
+        std::uint64_t m_words[SIGNATURE_WORDS];
+};
+
+// Signatures of a dimension: each element is represented by tokens, and the down-set holds the tokens of all the
+// elements below the dimension. dim1 can only be below dim2 if its elements may be a subset of the down-set of dim2,
+// and an element of dim1 can only be below dim2 if they may intersect
+struct DimensionSignature
+{
+    Signature elements;
+    Signature downSet;
+};
+
+// Signatures of the non-empty dimensions of a relation (in the order of Relation::getDimensions) and of its non-empty
+// aggregated dimensions, with masks of the non-empty ones. An empty signature rejects no pair
+class RelationSignature
+{
+    public:
+        RelationSignature();
+        RelationSignature(std::vector<DimensionSignature> dimensions, std::vector<std::uint64_t> nonEmpty,
+                          std::vector<DimensionSignature> aggregatedDimensions,
+                          std::vector<std::uint64_t> aggregatedNonEmpty);
+        bool mayBeComparable(const RelationSignature &other) const;
+        bool mayBeRelated(const RelationSignature &other, int nonEmptyDimensionLimit) const;
+
+    private:
+        std::vector<DimensionSignature> m_dimensions;
+        std::vector<std::uint64_t> m_nonEmpty;
+        std::vector<DimensionSignature> m_aggregatedDimensions;
+        std::vector<std::uint64_t> m_aggregatedNonEmpty;
+};
+
+
+#endif //TCN3R_SIGNATURE_H
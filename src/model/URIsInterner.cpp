@@ -0,0 +1,56 @@
+#include <algorithm>
+
+#include "URIsInterner.h"
+
+
+URIId URIsInterner::getId(std::string_view uri)
+{
+    return getCache().getElementIndex(uri);
+}
+
+bool URIsInterner::findId(std::string_view uri, URIId &id)
+{
+    return getCache().findElementIndex(uri, id);
+}
+
+std::string_view URIsInterner::getURI(URIId id)
+{
+    return getCache().getElementView(id);
+}
+
+std::vector<URIId> URIsInterner::getIds(const std::set<std::string> &uris)
+{
+    std::vector<URIId> ids;
+    ids.reserve(uris.size());
+
+    for (const auto &uri : uris)
+    {
+        ids.push_back(getId(uri));
+    }
+
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+std::set<std::string> URIsInterner::getURIs(const std::vector<URIId> &ids)
+{
+    std::set<std::string> uris;
+
+    for (const auto &id : ids)
+    {
+        uris.emplace(getURI(id));
+    }
+
+    return uris;
+}
+
+URIId URIsInterner::size()
+{
+    return getCache().size();
+}
+
+CacheManager& URIsInterner::getCache()
+{
+    static CacheManager cache;
+    return cache;
+}
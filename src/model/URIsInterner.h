@@ -0,0 +1,33 @@
+#ifndef TCN3R_URISINTERNER_H
+#define TCN3R_URISINTERNER_H
+
+
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../io/CacheManager.h"
+
+// Dense 32-bit identifier of a URI of the model
+typedef unsigned int URIId;
+
+// URIs of the model (individuals, relation elements, relations and predicates), interned once for the whole process:
+// model classes only hold identifiers. URIs are added while the model is built (single thread) and read while
+// relations are compared (any thread)
+class URIsInterner
+{
+    public:
+        static URIId getId(std::string_view uri);
+        static bool findId(std::string_view uri, URIId &id);
+        static std::string_view getURI(URIId id);
+        static std::vector<URIId> getIds(const std::set<std::string> &uris);
+        static std::set<std::string> getURIs(const std::vector<URIId> &ids);
+        static URIId size();
+
+    private:
+        static CacheManager& getCache();
+};
+
+
+#endif //TCN3R_URISINTERNER_H
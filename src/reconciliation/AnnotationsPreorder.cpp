@@ -1,10 +1,13 @@
+#include <utility>
+#include <vector>
+
 #include <boost/progress.hpp>
 
 #include "AnnotationsPreorder.h"
 
 AnnotationsPreorder::AnnotationsPreorder(std::map<Individual*, RelationElement*> &indToEl,
                                          IndividualsSet &individualsSet, PredicatesSet &predicatesSet,
-                                         const DimensionConfiguration &configuration) : Preorder(), m_msa(), m_ancestors()
+                                         const DimensionConfiguration &configuration) : Preorder(), m_msa(), m_hierarchy(), m_msaDownSets()
 {
     // Get hierarchical predicates
     std::set<Predicate*> leqPredicates;
@@ -19,7 +22,9 @@ AnnotationsPreorder::AnnotationsPreorder(std::map<Individual*, RelationElement*>
         geqPredicates.insert(predicatesSet.getPredicateFromUri(uri));
     }
 
-    // Instantiation of annotations + hierarchical organization for new annotations
+    // Instantiation of annotations + hierarchical organization for new annotations (direct parents of annotations and
+    // of their ancestors)
+    std::map<RelationElement*, std::set<RelationElement*>> parents;
     boost::progress_display progressBar(configuration.getPreorderConfiguration("ind2ann-predicates").size());
     for (const auto &uri : configuration.getPreorderConfiguration("ind2ann-predicates"))
     {
@@ -35,17 +40,26 @@ AnnotationsPreorder::AnnotationsPreorder(std::map<Individual*, RelationElement*>
                     RelationElement *ann(RelationElement::getRelationElementFromIndividual(indToEl, a));
                     m_msa[el].insert(ann);
 
-                    if (m_ancestors.find(ann) == m_ancestors.end())
+                    if (parents.find(ann) == parents.end())
                     {
-                        m_ancestors[ann].clear();
+                        std::vector<std::pair<RelationElement*, Individual*>> toExpand({{ann, a}});
 
-                        for (const auto &ancestorInd : a->getAncestors(leqPredicates, geqPredicates))
+                        while (!toExpand.empty())
                         {
-                            m_ancestors[ann].insert(RelationElement::getRelationElementFromIndividual(indToEl, ancestorInd));
+                            std::pair<RelationElement*, Individual*> current(toExpand.back());
+                            toExpand.pop_back();
+                            std::set<RelationElement*> &currentParents = parents[current.first];
 
-                            if (m_ancestors[ann].find(ann) != m_ancestors[ann].end())
+                            for (const auto &parentInd : individualsSet.getParents(current.second, leqPredicates, geqPredicates))
                             {
-                                m_ancestors[ann].erase(ann);
+                                RelationElement *parent(RelationElement::getRelationElementFromIndividual(indToEl, parentInd));
+                                currentParents.insert(parent);
+
+                                if (parents.find(parent) == parents.end())
+                                {
+                                    parents[parent].clear();
+                                    toExpand.emplace_back(parent, parentInd);
+                                }
                             }
                         }
                     }
@@ -56,31 +70,169 @@ AnnotationsPreorder::AnnotationsPreorder(std::map<Individual*, RelationElement*>
         ++progressBar;
     }
 
-    // Compute Most Specific Annotations
+    m_hierarchy = ElementsHierarchy(std::move(parents));
+
+    // Compute Most Specific Annotations: annotations that are not a strict ancestor of another annotation
     progressBar.restart(m_msa.size());
-    for (const auto &el2ann : m_msa)
+    for (auto &el2ann : m_msa)
     {
-        std::set<RelationElement*> ancestorsToRemove;
+        std::set<RelationElement*> msa;
         for (const auto &ann : el2ann.second)
         {
-            ancestorsToRemove.insert(m_ancestors[ann].begin(), m_ancestors[ann].end());
-        }
+            bool isAncestor(false);
+            for (auto it = el2ann.second.begin(); !isAncestor && it != el2ann.second.end(); it++)
+            {
+                isAncestor = (*it != ann && m_hierarchy.isAncestorOrSelf(*it, ann));
+            }
 
-        std::set<RelationElement*> msa;
-        std::set_difference(m_msa[el2ann.first].begin(), m_msa[el2ann.first].end(), ancestorsToRemove.begin(),
-                            ancestorsToRemove.end(), std::inserter(msa, msa.begin()));
+            if (!isAncestor)
+            {
+                msa.insert(ann);
+            }
+        }
 
-        m_msa[el2ann.first] = msa;
+        el2ann.second = msa;
 
         ++progressBar;
     }
 }
 
+AnnotationsPreorder::AnnotationsPreorder(SnapshotReader &reader, const std::vector<RelationElement*> &elements) :
+        Preorder(), m_msa(readElementsMap(reader, elements)), m_hierarchy(readElementsMap(reader, elements)),
+        m_msaDownSets()
+{
+
+}
+
 AnnotationsPreorder::~AnnotationsPreorder()
 = default;
 
+void AnnotationsPreorder::writeSnapshot(SnapshotWriter &writer, const std::map<RelationElement*, unsigned int> &elementIds) const
+{
+    writeElementsMap(writer, m_msa, elementIds);
+    writeElementsMap(writer, m_hierarchy.getParents(), elementIds);
+}
+
+void AnnotationsPreorder::indexDimensions(const std::vector<const std::set<RelationElement*>*> &dimensions)
+{
+    std::map<std::vector<unsigned int>, std::shared_ptr<const CompressedBitmap>> downSets;
+
+    for (const auto &dim : dimensions)
+    {
+        std::set<RelationElement*> msa;
+        for (const auto &el : *dim)
+        {
+            if (m_msa.find(el) != m_msa.end())
+            {
+                msa.insert(m_msa.at(el).begin(), m_msa.at(el).end());
+            }
+        }
+
+        std::vector<unsigned int> nodes(m_hierarchy.getNodes(msa));
+        std::shared_ptr<const CompressedBitmap> &downSet = downSets[nodes];
+        if (!downSet)
+        {
+            downSet = std::make_shared<const CompressedBitmap>(m_hierarchy.getDescendantsOrSelf(nodes));
+        }
+
+        m_msaDownSets[dim] = downSet;
+    }
+}
+
+DimensionSignature AnnotationsPreorder::getSignature(const std::set<RelationElement*> &dim) const
+{
+    // Tokens of an element: its most specific annotations, itself if it is not annotated, or this preorder (standing
+    // for any annotated dimension) if it has no most specific annotation. The down-set holds the elements of the
+    // dimension, the descendants of its most specific annotations, and this preorder if an element without most
+    // specific annotation is below the dimension
+    DimensionSignature signature;
+    bool withoutMsa(false);
+    std::set<RelationElement*> msa;
+    for (const auto &el : dim)
+    {
+        signature.downSet.add(el);
+
+        auto it = m_msa.find(el);
+        if (it == m_msa.end())
+        {
+            signature.elements.add(el);
+        }
+
+        else if (it->second.empty())
+        {
+            withoutMsa = true;
+            signature.elements.add(this);
+        }
+
+        else
+        {
+            msa.insert(it->second.begin(), it->second.end());
+        }
+    }
+
+    for (const auto &ann : msa)
+    {
+        signature.elements.add(ann);
+        signature.downSet.add(ann);
+    }
+
+    for (const auto &node : m_hierarchy.getDescendantsOrSelf(m_hierarchy.getNodes(msa)))
+    {
+        signature.downSet.add(m_hierarchy.getElement(node));
+    }
+
+    if (!msa.empty() || withoutMsa)
+    {
+        signature.downSet.add(this);
+    }
+
+    return signature;
+}
+
+bool AnnotationsPreorder::getTokens(const std::set<RelationElement*> &dim, std::set<RelationElement*> &probed,
+                                    std::set<RelationElement*> &posted) const
+{
+    // An element is below a dimension if it belongs to it, or if one of its most specific annotations is below a most
+    // specific annotation of the dimension (an element without most specific annotations is below any annotated
+    // dimension)
+    std::set<RelationElement*> msa;
+    for (const auto &el : dim)
+    {
+        auto it = m_msa.find(el);
+        if (it != m_msa.end())
+        {
+            if (it->second.empty())
+            {
+                return false;
+            }
+
+            msa.insert(it->second.begin(), it->second.end());
+        }
+    }
+
+    probed = m_hierarchy.getAncestorsOrSelf(msa);
+    probed.insert(dim.begin(), dim.end());
+    posted = msa;
+    posted.insert(dim.begin(), dim.end());
+    return true;
+}
+
 bool AnnotationsPreorder::isLeq(const std::set<RelationElement*> &dim1, const std::set<RelationElement*> &dim2) const
 {
+    auto msaDownSet2 = m_msaDownSets.find(&dim2);
+    if (msaDownSet2 != m_msaDownSets.end())
+    {
+        for (const auto &el1 : dim1)
+        {
+            if (!isLeq(el1, dim2, *msaDownSet2->second))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     // Get all most specific annotations from dimension 2
     std::set<RelationElement*> msa2;
     for (const auto &el2 : dim2)
@@ -170,11 +322,11 @@ bool AnnotationsPreorder::isLeq(RelationElement *el, const std::set<RelationElem
         if (msa2.find(ann) == msa2.end())
         {
             bool ancestorFound(false);
-            auto it(m_ancestors.at(ann).begin());
+            auto it(msa2.begin());
 
-            while (!ancestorFound && it != m_ancestors.at(ann).end())
+            while (!ancestorFound && it != msa2.end())
             {
-                if (msa2.find(*it) != msa2.end())
+                if (m_hierarchy.isAncestorOrSelf(ann, *it))
                 {
                     ancestorFound = true;
                 }
@@ -191,3 +343,28 @@ bool AnnotationsPreorder::isLeq(RelationElement *el, const std::set<RelationElem
 
     return true;
 }
+
+bool AnnotationsPreorder::isLeq(RelationElement *el, const std::set<RelationElement*> &dim2, const CompressedBitmap &msaDownSet2) const
+{
+    // Each most specific annotation of el is below a most specific annotation of dim2
+    if (dim2.find(el) != dim2.end())
+    {
+        return true;
+    }
+
+    if (m_msa.find(el) == m_msa.end() || msaDownSet2.empty())
+    {
+        return false;
+    }
+
+    for (const auto &ann : m_msa.at(el))
+    {
+        unsigned int node(0);
+        if (!m_hierarchy.findNode(ann, node) || !msaDownSet2.contains(node))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
\ No newline at end of file
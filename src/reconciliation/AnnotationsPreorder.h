@@ -3,8 +3,13 @@
 
 
 #include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
 #include "../configuration/DimensionConfiguration.h"
+#include "../model/CompressedBitmap.h"
+#include "../model/ElementsHierarchy.h"
 #include "../model/Individual.h"
 #include "../model/IndividualsSet.h"
 #include "../model/PredicatesSet.h"
@@ -16,7 +21,13 @@ class AnnotationsPreorder : public Preorder
     public:
         AnnotationsPreorder(std::map<Individual*, RelationElement*> &indToEl, IndividualsSet &individualsSet,
                             PredicatesSet &predicatesSet, const DimensionConfiguration &configuration);
+        AnnotationsPreorder(SnapshotReader &reader, const std::vector<RelationElement*> &elements);
         virtual ~AnnotationsPreorder();
+        virtual void writeSnapshot(SnapshotWriter &writer, const std::map<RelationElement*, unsigned int> &elementIds) const;
+        virtual void indexDimensions(const std::vector<const std::set<RelationElement*>*> &dimensions);
+        virtual DimensionSignature getSignature(const std::set<RelationElement*> &dim) const;
+        virtual bool getTokens(const std::set<RelationElement*> &dim, std::set<RelationElement*> &probed,
+                               std::set<RelationElement*> &posted) const;
 
     protected:
         virtual bool isLeq(const std::set<RelationElement*> &dim1, const std::set<RelationElement*> &dim2) const;
@@ -24,9 +35,13 @@ class AnnotationsPreorder : public Preorder
 
     private:
         bool isLeq(RelationElement *el, const std::set<RelationElement*> &dim2, const std::set<RelationElement*> &msa2) const;
+        bool isLeq(RelationElement *el, const std::set<RelationElement*> &dim2, const CompressedBitmap &msaDownSet2) const;
 
         std::map<RelationElement*, std::set<RelationElement*>> m_msa;
-        std::map<RelationElement*, std::set<RelationElement*>> m_ancestors;
+        ElementsHierarchy m_hierarchy;
+
+        // Down-set of the most specific annotations of each indexed dimension (annotations below one of them)
+        std::unordered_map<const std::set<RelationElement*>*, std::shared_ptr<const CompressedBitmap>> m_msaDownSets;
 };
 
 
@@ -0,0 +1,80 @@
+#include <cstdint>
+
+#include "ComparisonsMemo.h"
+
+
+ComparisonsMemo::ComparisonsMemo() : m_shards()
+{
+
+}
+
+OrderResult ComparisonsMemo::compare(const Preorder *preorder, unsigned int id1, unsigned int id2,
+                                     const std::set<RelationElement*> &dim1, const std::set<RelationElement*> &dim2)
+{
+    Key key{preorder, id1, id2};
+    Shard &shard = getShard(key);
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.results.find(key);
+        if (it != shard.results.end())
+        {
+            return it->second;
+        }
+    }
+
+    OrderResult result = preorder->compare(dim1, dim2);
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (shard.results.size() < MEMO_SHARD_CAPACITY)
+    {
+        shard.results.emplace(key, result);
+    }
+
+    return result;
+}
+
+double ComparisonsMemo::incomparableJacquard(const Preorder *preorder, unsigned int id1, unsigned int id2,
+                                             const std::set<RelationElement*> &dim1,
+                                             const std::set<RelationElement*> &dim2)
+{
+    Key key{preorder, id1, id2};
+    Shard &shard = getShard(key);
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.jacquards.find(key);
+        if (it != shard.jacquards.end())
+        {
+            return it->second;
+        }
+    }
+
+    double jacquard = preorder->incomparableJacquard(dim1, dim2);
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (shard.jacquards.size() < MEMO_SHARD_CAPACITY)
+    {
+        shard.jacquards.emplace(key, jacquard);
+    }
+
+    return jacquard;
+}
+
+bool ComparisonsMemo::Key::operator==(const Key &other) const
+{
+    return preorder == other.preorder && id1 == other.id1 && id2 == other.id2;
+}
+
+std::size_t ComparisonsMemo::KeyHash::operator()(const Key &key) const
+{
+    // 64-bit mix of the identifiers (splitmix64 finalizer), combined with the preorder
+    std::uint64_t hash = (static_cast<std::uint64_t>(key.id1) << 32 | key.id2) ^
+                         static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(key.preorder));
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+    return static_cast<std::size_t>(hash ^ (hash >> 31));
+}
+
+ComparisonsMemo::Shard& ComparisonsMemo::getShard(const Key &key)
+{
+    return m_shards[(KeyHash()(key) >> 32) % MEMO_SHARDS];
+}
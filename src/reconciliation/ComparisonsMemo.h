@@ -0,0 +1,61 @@
+#ifndef TCN3R_COMPARISONSMEMO_H
+#define TCN3R_COMPARISONSMEMO_H
+
+
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+
+#include "../model/RelationElement.h"
+#include "Preorder.h"
+
+// Number of independently locked parts of the memo
+#define MEMO_SHARDS 64
+
+// Maximum number of results kept by each part of the memo (for each kind of result), later results are not stored
+#define MEMO_SHARD_CAPACITY 16384
+
+// Results of Preorder::compare and Preorder::incomparableJacquard between interned dimensions (see
+// ElementSetsInterner), keyed by (preorder, set1, set2) and shared by the threads of the batch reconciliation. Results
+// are computed outside of the locks: two threads may compute the same result, which is then stored once. Only sets used
+// by several dimensions are worth it (see ElementSetsInterner::isShared), the memo is bounded by MEMO_SHARD_CAPACITY
+class ComparisonsMemo
+{
+    public:
+        ComparisonsMemo();
+        OrderResult compare(const Preorder *preorder, unsigned int id1, unsigned int id2,
+                            const std::set<RelationElement*> &dim1, const std::set<RelationElement*> &dim2);
+        double incomparableJacquard(const Preorder *preorder, unsigned int id1, unsigned int id2,
+                                    const std::set<RelationElement*> &dim1, const std::set<RelationElement*> &dim2);
+
+    private:
+        struct Key
+        {
+            const Preorder *preorder;
+            unsigned int id1;
+            unsigned int id2;
+
+            bool operator==(const Key &other) const;
+        };
+
+        struct KeyHash
+        {
+            std::size_t operator()(const Key &key) const;
+        };
+
+        struct Shard
+        {
+            std::mutex mutex;
+            std::unordered_map<Key, OrderResult, KeyHash> results;
+            std::unordered_map<Key, double, KeyHash> jacquards;
+        };
+
+        Shard& getShard(const Key &key);
+
+        std::array<Shard, MEMO_SHARDS> m_shards;
+};
+
+
+#endif //TCN3R_COMPARISONSMEMO_H
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <utility>
+
 #include <boost/progress.hpp>
 
 #include "IndividualsPreorder.h"
@@ -5,8 +8,10 @@
 
 IndividualsPreorder::IndividualsPreorder(std::map<Individual*, RelationElement*> &indToEl,
                                          IndividualsSet &individualsSet, PredicatesSet &predicatesSet,
-                                         const DimensionConfiguration &configuration) : Preorder(), m_ancestors()
+                                         const DimensionConfiguration &configuration) : Preorder(), m_hierarchy(), m_dimensionIndexes()
 {
+    std::map<RelationElement*, std::set<RelationElement*>> parents;
+
     // LEQ predicates
     boost::progress_display progressBar(configuration.getPreorderConfiguration("ind-leq-predicates").size());
     for (const auto &uri : configuration.getPreorderConfiguration("ind-leq-predicates"))
@@ -19,12 +24,7 @@ IndividualsPreorder::IndividualsPreorder(std::map<Individual*, RelationElement*>
             for (const auto &i : i2a.second)
             {
                 RelationElement *el2(RelationElement::getRelationElementFromIndividual(indToEl, i));
-                m_ancestors[el].insert(el2);
-
-                if (m_ancestors.find(el2) == m_ancestors.end())
-                {
-                    m_ancestors[el2].clear();
-                }
+                parents[el].insert(el2);
             }
         }
 
@@ -43,53 +43,100 @@ IndividualsPreorder::IndividualsPreorder(std::map<Individual*, RelationElement*>
             for (const auto &i : i2a.second)
             {
                 RelationElement *el2(RelationElement::getRelationElementFromIndividual(indToEl, i));
-                m_ancestors[el2].insert(el);
-
-                if (m_ancestors.find(el) == m_ancestors.end())
-                {
-                    m_ancestors[el].clear();
-                }
+                parents[el2].insert(el);
             }
         }
 
         ++progressBar;
     }
 
-    // Compute ancestors by expanding hierarchy
-    progressBar.restart(m_ancestors.size());
-    for (const auto &el2a : m_ancestors)
+    // Index the hierarchy instead of expanding the ancestors of each element
+    m_hierarchy = ElementsHierarchy(std::move(parents));
+}
+
+IndividualsPreorder::IndividualsPreorder(SnapshotReader &reader, const std::vector<RelationElement*> &elements) :
+        Preorder(), m_hierarchy(readElementsMap(reader, elements)), m_dimensionIndexes()
+{
+
+}
+
+IndividualsPreorder::~IndividualsPreorder()
+= default;
+
+void IndividualsPreorder::writeSnapshot(SnapshotWriter &writer, const std::map<RelationElement*, unsigned int> &elementIds) const
+{
+    writeElementsMap(writer, m_hierarchy.getParents(), elementIds);
+}
+
+void IndividualsPreorder::indexDimensions(const std::vector<const std::set<RelationElement*>*> &dimensions)
+{
+    std::map<std::vector<unsigned int>, std::shared_ptr<const CompressedBitmap>> downSets;
+
+    for (const auto &dim : dimensions)
     {
-        std::set<RelationElement*> toExpand(m_ancestors[el2a.first]);
+        DimensionIndex &index = m_dimensionIndexes[dim];
+        std::vector<unsigned int> nodes(m_hierarchy.getNodes(*dim));
+        index.nodes = CompressedBitmap(nodes);
+        index.outside.clear();
 
-        while (!toExpand.empty())
+        for (const auto &el : *dim)
         {
-            std::set<RelationElement*> newToExpand;
-
-            for (const auto &a : toExpand)
+            unsigned int node(0);
+            if (!m_hierarchy.findNode(el, node))
             {
-                newToExpand.insert(m_ancestors[a].begin(), m_ancestors[a].end());
+                index.outside.push_back(el);
             }
-
-            toExpand.clear();
-            std::set_difference(newToExpand.begin(), newToExpand.end(), m_ancestors[el2a.first].begin(),
-                                m_ancestors[el2a.first].end(), std::inserter(toExpand, toExpand.begin()));
-            m_ancestors[el2a.first].insert(toExpand.begin(), toExpand.end());
         }
 
-        if (m_ancestors[el2a.first].find(el2a.first) != m_ancestors[el2a.first].end())
+        std::shared_ptr<const CompressedBitmap> &downSet = downSets[nodes];
+        if (!downSet)
         {
-            m_ancestors[el2a.first].erase(el2a.first);
+            downSet = std::make_shared<const CompressedBitmap>(m_hierarchy.getDescendantsOrSelf(nodes));
         }
 
-        ++progressBar;
+        index.downSet = downSet;
     }
 }
 
-IndividualsPreorder::~IndividualsPreorder()
-= default;
+DimensionSignature IndividualsPreorder::getSignature(const std::set<RelationElement*> &dim) const
+{
+    // An element is below the dimension if it is one of its elements or one of their descendants
+    DimensionSignature signature;
+    for (const auto &el : dim)
+    {
+        signature.elements.add(el);
+        signature.downSet.add(el);
+    }
+
+    for (const auto &node : m_hierarchy.getDescendantsOrSelf(m_hierarchy.getNodes(dim)))
+    {
+        signature.downSet.add(m_hierarchy.getElement(node));
+    }
+
+    return signature;
+}
+
+bool IndividualsPreorder::getTokens(const std::set<RelationElement*> &dim, std::set<RelationElement*> &probed,
+                                    std::set<RelationElement*> &posted) const
+{
+    // An element is only below its ancestors (or itself)
+    probed = m_hierarchy.getAncestorsOrSelf(dim);
+    posted = dim;
+    return true;
+}
 
 bool IndividualsPreorder::isLeq(const std::set<RelationElement*> &dim1, const std::set<RelationElement*> &dim2) const
 {
+    // Indexed dimensions: elements of dim1 in the hierarchy are in the down-set of dim2, the others are in dim2
+    auto index1 = m_dimensionIndexes.find(&dim1);
+    auto index2 = m_dimensionIndexes.find(&dim2);
+    if (index1 != m_dimensionIndexes.end() && index2 != m_dimensionIndexes.end())
+    {
+        return index1->second.nodes.isSubsetOf(*index2->second.downSet) &&
+               std::includes(index2->second.outside.begin(), index2->second.outside.end(),
+                             index1->second.outside.begin(), index1->second.outside.end());
+    }
+
     for (const auto &el : dim1)
     {
         if (!isLeq(el, dim2))
@@ -136,20 +183,12 @@ bool IndividualsPreorder::isLeq(RelationElement *el, const std::set<RelationElem
         return true;
     }
 
-    if (m_ancestors.find(el) == m_ancestors.end())
-    {
-        return false;
-    }
-
-    auto it(m_ancestors.at(el).begin());
-    while (it != m_ancestors.at(el).end())
+    for (const auto &el2 : dim2)
     {
-        if (dim2.find(*it) != dim2.end())
+        if (m_hierarchy.isAncestorOrSelf(el, el2))
         {
             return true;
         }
-
-        it++;
     }
 
     return false;
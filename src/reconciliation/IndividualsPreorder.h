@@ -3,8 +3,13 @@
 
 
 #include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
 #include "../configuration/DimensionConfiguration.h"
+#include "../model/CompressedBitmap.h"
+#include "../model/ElementsHierarchy.h"
 #include "../model/IndividualsSet.h"
 #include "../model/PredicatesSet.h"
 #include "Preorder.h"
@@ -14,14 +19,30 @@ class IndividualsPreorder : public Preorder
     public:
         IndividualsPreorder(std::map<Individual*, RelationElement*> &indToEl, IndividualsSet &individualsSet,
                             PredicatesSet &predicatesSet, const DimensionConfiguration &configuration);
+        IndividualsPreorder(SnapshotReader &reader, const std::vector<RelationElement*> &elements);
         virtual ~IndividualsPreorder();
+        virtual void writeSnapshot(SnapshotWriter &writer, const std::map<RelationElement*, unsigned int> &elementIds) const;
+        virtual void indexDimensions(const std::vector<const std::set<RelationElement*>*> &dimensions);
+        virtual DimensionSignature getSignature(const std::set<RelationElement*> &dim) const;
+        virtual bool getTokens(const std::set<RelationElement*> &dim, std::set<RelationElement*> &probed,
+                               std::set<RelationElement*> &posted) const;
 
     protected:
         virtual bool isLeq(const std::set<RelationElement*> &dim1, const std::set<RelationElement*> &dim2) const;
         virtual unsigned long countIncomparableElements(const std::set<RelationElement*> &dim1, const std::set<RelationElement*> &dim2) const;
 
     private:
-        std::map<RelationElement*, std::set<RelationElement*>> m_ancestors;
+        // Index of a dimension: its elements in the hierarchy, their down-set (elements below one of them, shared by
+        // the dimensions with the same elements in the hierarchy) and its elements outside of the hierarchy
+        struct DimensionIndex
+        {
+            CompressedBitmap nodes;
+            std::shared_ptr<const CompressedBitmap> downSet;
+            std::vector<RelationElement*> outside;
+        };
+
+        ElementsHierarchy m_hierarchy;
+        std::unordered_map<const std::set<RelationElement*>*, DimensionIndex> m_dimensionIndexes;
         bool isLeq(RelationElement *el, const std::set<RelationElement*> &dim2) const;
 };
 
@@ -0,0 +1,196 @@
+#include "IngestionPlanner.h"
+
+
+IngestionPlanner::IngestionPlanner(const TriplestoreManager &triplestoreManager, const Configuration &parameters,
+                                   const Logger &logger) : m_parameters(parameters), m_subClassOfEdges(),
+                                                           m_relationClasses(), m_elementClasses()
+{
+    if (!m_parameters.isScopedIngestion())
+    {
+        return;
+    }
+
+    logger.info("Query rdfs:subClassOf edges");
+    m_subClassOfEdges = triplestoreManager.queryTwoElements("?e1 rdfs:subClassOf ?e2");
+
+    m_relationClasses = getSubClasses(m_parameters.getRelationTypes());
+
+    std::set<std::string> dimensionTypes;
+    for (const auto &d : m_parameters.getDimensions())
+    {
+        std::set<std::string> individualTypes = d.second.getIndividualTypes();
+        dimensionTypes.insert(individualTypes.begin(), individualTypes.end());
+    }
+
+    m_elementClasses = getSubClasses(dimensionTypes);
+
+    logger.info("Ingestion scoped to " + std::to_string(m_relationClasses.size()) + " relation types and "
+                + std::to_string(m_elementClasses.size()) + " dimension types");
+}
+
+std::set<std::string> IngestionPlanner::getSameAsWhereClauses() const
+{
+    if (!m_parameters.isScopedIngestion())
+    {
+        return {"?e1 owl:sameAs ?e2"};
+    }
+
+    std::set<std::string> classes(m_relationClasses);
+    classes.insert(m_elementClasses.begin(), m_elementClasses.end());
+
+    return {"?e1 owl:sameAs ?e2" + typeScope("e1", classes), "?e1 owl:sameAs ?e2" + typeScope("e2", classes)};
+}
+
+std::map<std::string, std::set<Predicate*>> IngestionPlanner::getEdgesScopes(PredicatesSet &predicatesSet) const
+{
+    // Scopes of the edges of each predicate, an empty scope is for all the edges
+    std::map<Predicate*, std::set<std::string>> predicateScopes;
+    Predicate *type = predicatesSet.getPredicateFromUri("http://www.w3.org/1999/02/22-rdf-syntax-ns#type");
+    Predicate *subClassOf = predicatesSet.getPredicateFromUri("http://www.w3.org/2000/01/rdf-schema#subClassOf");
+
+    // Edges of descendants are edges of the predicate, edges of inverses are reversed edges of the predicate
+    auto addScopes = [&predicateScopes, &predicatesSet](Predicate *p, const std::string &subjectScope,
+                                                        const std::string &objectScope) {
+        predicateScopes[p].insert(subjectScope);
+
+        for (const auto &descendant : predicatesSet.getDescendants(p))
+        {
+            predicateScopes[descendant].insert(subjectScope);
+        }
+
+        for (const auto &inverse : p->getInverses())
+        {
+            predicateScopes[inverse].insert(objectScope);
+        }
+    };
+
+    if (!m_parameters.isScopedIngestion())
+    {
+        predicateScopes[type].insert("");
+        predicateScopes[subClassOf].insert("");
+
+        for (const auto &pUri : m_parameters.getPredicatesInDimensions())
+        {
+            addScopes(predicatesSet.getPredicateFromUri(pUri), "", "");
+        }
+    }
+
+    else
+    {
+        std::set<std::string> classes(m_relationClasses);
+        classes.insert(m_elementClasses.begin(), m_elementClasses.end());
+        predicateScopes[type].insert(valuesScope("e2", classes));
+
+        for (const auto &d : m_parameters.getDimensions())
+        {
+            std::set<std::string> scopedPredicates;
+
+            for (const auto &pUri : d.second.getRelToIndPredicates())
+            {
+                addScopes(predicatesSet.getPredicateFromUri(pUri), typeScope("e1", m_relationClasses),
+                          typeScope("e2", m_relationClasses));
+                scopedPredicates.insert(pUri);
+            }
+
+            std::set<std::string> elementPredicates = d.second.getIndToDepPredicates();
+            if (d.second.getPreorderName() == ANNOTATIONS)
+            {
+                std::set<std::string> annotationPredicates = d.second.getPreorderConfiguration("ind2ann-predicates");
+                elementPredicates.insert(annotationPredicates.begin(), annotationPredicates.end());
+            }
+
+            for (const auto &pUri : elementPredicates)
+            {
+                addScopes(predicatesSet.getPredicateFromUri(pUri), typeScope("e1", m_elementClasses),
+                          typeScope("e2", m_elementClasses));
+                scopedPredicates.insert(pUri);
+            }
+
+            // Hierarchies of preorders
+            for (const auto &pUri : d.second.getUsedPredicates())
+            {
+                if (scopedPredicates.find(pUri) == scopedPredicates.end())
+                {
+                    addScopes(predicatesSet.getPredicateFromUri(pUri), "", "");
+                }
+            }
+        }
+
+        // All rdfs:subClassOf edges are already known
+        predicateScopes.erase(subClassOf);
+    }
+
+    std::map<std::string, std::set<Predicate*>> scopes;
+    for (const auto &p2s : predicateScopes)
+    {
+        if (p2s.second.find("") != p2s.second.end())
+        {
+            scopes[""].insert(p2s.first);
+            continue;
+        }
+
+        for (const auto &scope : p2s.second)
+        {
+            scopes[scope].insert(p2s.first);
+        }
+    }
+
+    return scopes;
+}
+
+std::set<std::pair<std::string, std::string>> IngestionPlanner::getSubClassOfEdges() const
+{
+    return m_subClassOfEdges;
+}
+
+std::set<std::string> IngestionPlanner::getSubClasses(const std::set<std::string> &classes) const
+{
+    std::map<std::string, std::set<std::string>> subClasses;
+    for (const auto &e : m_subClassOfEdges)
+    {
+        subClasses[e.second].insert(e.first);
+    }
+
+    std::set<std::string> closure(classes);
+    std::set<std::string> toExpand(classes);
+
+    while (!toExpand.empty())
+    {
+        std::set<std::string> newToExpand;
+        for (const auto &c : toExpand)
+        {
+            for (const auto &subClass : subClasses[c])
+            {
+                if (closure.insert(subClass).second)
+                {
+                    newToExpand.insert(subClass);
+                }
+            }
+        }
+
+        toExpand.clear();
+        toExpand.insert(newToExpand.begin(), newToExpand.end());
+    }
+
+    return closure;
+}
+
+std::string IngestionPlanner::typeScope(const std::string &variable, const std::set<std::string> &classes)
+{
+    return " . ?" + variable + " <http://www.w3.org/1999/02/22-rdf-syntax-ns#type> ?c" + valuesScope("c", classes);
+}
+
+std::string IngestionPlanner::valuesScope(const std::string &variable, const std::set<std::string> &classes)
+{
+    // Blank nodes (e.g., OWL restrictions) cannot be given in queries, IRIs always contain a scheme
+    std::string scope(" VALUES ?" + variable + " {");
+    for (const auto &c : classes)
+    {
+        if (c.find(':') != std::string::npos)
+        {
+            scope += " <" + c + ">";
+        }
+    }
+
+    return scope + " }";
+}
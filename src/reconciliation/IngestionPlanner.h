@@ -0,0 +1,45 @@
+#ifndef TCN3R_INGESTIONPLANNER_H
+#define TCN3R_INGESTIONPLANNER_H
+
+
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+
+#include "../configuration/Configuration.h"
+#include "../io/Logger.h"
+#include "../io/TriplestoreManager.h"
+#include "../model/Predicate.h"
+#include "../model/PredicatesSet.h"
+
+// Plans the edges to download from the triplestore. Without scoped ingestion, all the edges of the useful predicates
+// are queried. With scoped ingestion, edges are restricted in the queries to the neighbourhood of relations:
+// rdf:type edges to relation and dimension types (and their subclasses), dimension edges to subjects typed with them
+// (objects for inverse predicates), owl:sameAs edges to individuals typed with them. Hierarchies used by preorders are
+// still fully queried, and rdfs:subClassOf edges are queried first to compute the subclasses of types
+class IngestionPlanner
+{
+    public:
+        IngestionPlanner(const TriplestoreManager &triplestoreManager, const Configuration &parameters, const Logger &logger);
+        std::set<std::string> getSameAsWhereClauses() const;
+        std::map<std::string, std::set<Predicate*>> getEdgesScopes(PredicatesSet &predicatesSet) const;
+        std::set<std::pair<std::string, std::string>> getSubClassOfEdges() const;
+
+    private:
+        std::set<std::string> getSubClasses(const std::set<std::string> &classes) const;
+        static std::string typeScope(const std::string &variable, const std::set<std::string> &classes);
+        static std::string valuesScope(const std::string &variable, const std::set<std::string> &classes);
+
+        const Configuration &m_parameters;
+
+        // Prefetched rdfs:subClassOf edges (scoped ingestion only)
+        std::set<std::pair<std::string, std::string>> m_subClassOfEdges;
+
+        // Relation types and types of dimensions, with their subclasses
+        std::set<std::string> m_relationClasses;
+        std::set<std::string> m_elementClasses;
+};
+
+
+#endif //TCN3R_INGESTIONPLANNER_H
@@ -86,3 +86,73 @@ double Preorder::incomparableJacquard(const std::set<RelationElement *> &dim1, c
 
     return 1.0 - static_cast<double>(nbIncomparableElements) / static_cast<double>(dimUnion.size());
 }
+
+void Preorder::writeSnapshot(SnapshotWriter &writer, const std::map<RelationElement*, unsigned int> &elementIds) const
+{
+
+}
+
+void Preorder::indexDimensions(const std::vector<const std::set<RelationElement*>*> &dimensions)
+{
+
+}
+
+DimensionSignature Preorder::getSignature(const std::set<RelationElement*> &dim) const
+{
+    // Without hierarchy, an element is only below itself
+    DimensionSignature signature;
+    for (const auto &el : dim)
+    {
+        signature.elements.add(el);
+    }
+
+    signature.downSet = signature.elements;
+    return signature;
+}
+
+void Preorder::writeElements(SnapshotWriter &writer, const std::set<RelationElement*> &elements,
+                             const std::map<RelationElement*, unsigned int> &elementIds)
+{
+    writer.writeUInt32(static_cast<unsigned int>(elements.size()));
+    for (const auto &el : elements)
+    {
+        writer.writeUInt32(elementIds.at(el));
+    }
+}
+
+std::set<RelationElement*> Preorder::readElements(SnapshotReader &reader, const std::vector<RelationElement*> &elements)
+{
+    std::set<RelationElement*> readElements;
+    unsigned int count = reader.readUInt32();
+    for (unsigned int i = 0; i < count; i++)
+    {
+        readElements.insert(elements[reader.readIndex(elements.size())]);
+    }
+
+    return readElements;
+}
+
+void Preorder::writeElementsMap(SnapshotWriter &writer, const std::map<RelationElement*, std::set<RelationElement*>> &elementsMap,
+                                const std::map<RelationElement*, unsigned int> &elementIds)
+{
+    writer.writeUInt32(static_cast<unsigned int>(elementsMap.size()));
+    for (const auto &el2set : elementsMap)
+    {
+        writer.writeUInt32(elementIds.at(el2set.first));
+        writeElements(writer, el2set.second, elementIds);
+    }
+}
+
+std::map<RelationElement*, std::set<RelationElement*>> Preorder::readElementsMap(SnapshotReader &reader,
+                                                                                 const std::vector<RelationElement*> &elements)
+{
+    std::map<RelationElement*, std::set<RelationElement*>> elementsMap;
+    unsigned int count = reader.readUInt32();
+    for (unsigned int i = 0; i < count; i++)
+    {
+        RelationElement *el = elements[reader.readIndex(elements.size())];
+        elementsMap[el] = readElements(reader, elements);
+    }
+
+    return elementsMap;
+}
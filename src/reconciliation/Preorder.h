@@ -2,10 +2,15 @@
 #define TCN3R_PREORDER_H
 
 
+#include <map>
 #include <set>
 #include <string>
+#include <vector>
 
+#include "../io/SnapshotReader.h"
+#include "../io/SnapshotWriter.h"
 #include "../model/RelationElement.h"
+#include "../model/Signature.h"
 
 enum OrderResult
 {
@@ -35,8 +40,24 @@ class Preorder
         OrderResult compare(const std::set<RelationElement*> &dim1, const std::set<RelationElement*> &dim2) const;
         double incomparableJacquard(const std::set<RelationElement*> &dim1, const std::set<RelationElement*> &dim2) const;
         static std::string toString(OrderResult r);
+        virtual void writeSnapshot(SnapshotWriter &writer, const std::map<RelationElement*, unsigned int> &elementIds) const;
+        virtual void indexDimensions(const std::vector<const std::set<RelationElement*>*> &dimensions);
+        // Signature of a dimension for the rejection of incomparable pairs (see DimensionSignature)
+        virtual DimensionSignature getSignature(const std::set<RelationElement*> &dim) const;
+        // Tokens of a dimension for the candidate pairs of the batch reconciliation: an element of dim1 can only be
+        // below dim2 if one of the probed tokens of dim1 is a posted token of dim2. Returns false if an element of the
+        // dimension may be below a dimension without sharing a token
+        virtual bool getTokens(const std::set<RelationElement*> &dim, std::set<RelationElement*> &probed,
+                               std::set<RelationElement*> &posted) const = 0;
+        static void writeElements(SnapshotWriter &writer, const std::set<RelationElement*> &elements,
+                                  const std::map<RelationElement*, unsigned int> &elementIds);
+        static std::set<RelationElement*> readElements(SnapshotReader &reader, const std::vector<RelationElement*> &elements);
 
     protected:
+        static void writeElementsMap(SnapshotWriter &writer, const std::map<RelationElement*, std::set<RelationElement*>> &elementsMap,
+                                     const std::map<RelationElement*, unsigned int> &elementIds);
+        static std::map<RelationElement*, std::set<RelationElement*>> readElementsMap(SnapshotReader &reader,
+                                                                                      const std::vector<RelationElement*> &elements);
         virtual bool isLeq(const std::set<RelationElement*> &dim1, const std::set<RelationElement*> &dim2) const = 0;
         virtual unsigned long countIncomparableElements(const std::set<RelationElement*> &dim1, const std::set<RelationElement*> &dim2) const = 0;
 };
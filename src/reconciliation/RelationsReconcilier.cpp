@@ -1,10 +1,12 @@
 #include <algorithm>
+#include <cstdint>
 #include <numeric>
 #include <utility>
 #include <vector>
 
 #include <boost/progress.hpp>
 
+#include "../model/InstancesIndex.h"
 #include "AnnotationsPreorder.h"
 #include "IndividualsPreorder.h"
 #include "RelationsReconcilier.h"
@@ -12,97 +14,231 @@
 #include "SetInclusionPreorder.h"
 
 
-RelationsReconcilier::RelationsReconcilier(const ServerManager &serverManager, const Configuration &parameters,
-                                           const Logger &logger) : m_predicatesSet(serverManager, logger), m_relations(),
+RelationsReconcilier::RelationsReconcilier(const TriplestoreManager &triplestoreManager, const Configuration &parameters,
+                                           const Logger &logger) : m_predicatesSet(triplestoreManager, parameters, logger), m_relations(),
                                                                        m_uriToRelation(), m_relationElements()
 {
+    // Plan the edges to query
+    IngestionPlanner ingestionPlanner(triplestoreManager, parameters, logger);
+
     // Build individuals set (handling canonical individuals from owl:sameAs edges)
-    IndividualsSet individualsSet(serverManager, logger);
+    IndividualsSet individualsSet(triplestoreManager, ingestionPlanner.getSameAsWhereClauses(),
+                                  static_cast<unsigned long>(parameters.getPipelineCapacity()), logger);
 
     // Add edges for useful predicates
-    addEdges(individualsSet, serverManager, parameters, logger);
+    addEdges(individualsSet, triplestoreManager, ingestionPlanner, parameters, logger);
+    individualsSet.freeze(logger);
 
     // Build relations
     buildRelationsAndPreorders(individualsSet, parameters, logger);
 }
 
-RelationsReconcilier::~RelationsReconcilier()
+RelationsReconcilier::RelationsReconcilier(SnapshotReader &reader, const Configuration &parameters, const Logger &logger) :
+        m_predicatesSet(), m_relations(), m_uriToRelation(), m_relationElements()
 {
-    for (const auto &r : m_relations)
+    // Check that the snapshot has been built with the same dimensions and preorders
+    logger.info("Check dimensions of the snapshot");
+    std::map<std::string, const DimensionConfiguration> dimensions = parameters.getDimensions();
+    bool sameDimensions(reader.readUInt32() == dimensions.size());
+    for (const auto &d : dimensions)
     {
-        delete r;
+        if (!sameDimensions)
+        {
+            break;
+        }
+
+        const std::string &name = reader.readString();
+        unsigned int preorderName = reader.readUInt32();
+        sameDimensions = (name == d.first && preorderName == static_cast<unsigned int>(d.second.getPreorderName()));
     }
 
-    for (const auto &el : m_relationElements)
+    if (!sameDimensions)
     {
-        delete el;
+        logger.critical("Snapshot built with other dimensions than the configuration, run the ingest phase again");
+        std::exit(-1);
     }
 
-    for (const auto &p : m_preorders)
+    // Read relation elements and their dependencies
+    logger.info("Read relation elements");
+    std::vector<RelationElement*> elements(reader.readUInt32());
+    for (auto &el : elements)
     {
-        delete p.second;
+        el = new RelationElement(URIsInterner::getIds(reader.readStrings()));
+        m_relationElements.insert(el);
+
+        for (const auto &dimensionName : reader.readStrings())
+        {
+            el->addInDimension(dimensionName);
+        }
     }
-}
 
-void RelationsReconcilier::addEdges(IndividualsSet &individualsSet, const ServerManager &serverManager,
-                                    const Configuration &parameters, const Logger &logger)
-{
-    // Detect useful predicates to add
-    std::set<Predicate*> predicatesToQuery;
-    predicatesToQuery.insert(m_predicatesSet.getPredicateFromUri("http://www.w3.org/1999/02/22-rdf-syntax-ns#type"));
-    predicatesToQuery.insert(m_predicatesSet.getPredicateFromUri("http://www.w3.org/2000/01/rdf-schema#subClassOf"));
+    for (const auto &el : elements)
+    {
+        unsigned int dependenciesCount = reader.readUInt32();
+        for (unsigned int i = 0; i < dependenciesCount; i++)
+        {
+            std::string dimensionName(reader.readString());
+            for (const auto &dep : Preorder::readElements(reader, elements))
+            {
+                el->addDependency(dimensionName, dep);
+            }
+        }
+    }
 
-    for (const auto &pUri : parameters.getPredicatesInDimensions())
+    // Read relations
+    logger.info("Read relations");
+    unsigned int relationsCount = reader.readUInt32();
+    for (unsigned int i = 0; i < relationsCount; i++)
     {
-        predicatesToQuery.insert(m_predicatesSet.getPredicateFromUri(pUri));
+        std::vector<URIId> uris(URIsInterner::getIds(reader.readStrings()));
+        std::map<std::pair<std::string, Predicate*>, std::set<RelationElement*>> relDimensions;
 
-        for (const auto &descendant : m_predicatesSet.getPredicateFromUri(pUri)->getDescendants())
+        unsigned int dimensionsCount = reader.readUInt32();
+        for (unsigned int j = 0; j < dimensionsCount; j++)
         {
-            predicatesToQuery.insert(descendant);
+            std::string dimensionName(reader.readString());
+            Predicate *p = m_predicatesSet.getPredicateFromUri(reader.readString());
+            relDimensions[std::make_pair(dimensionName, p)] = Preorder::readElements(reader, elements);
         }
 
-        for (const auto &inverse : m_predicatesSet.getPredicateFromUri(pUri)->getInverses())
+        auto *rel = new Relation(uris, relDimensions);
+        m_relations.push_back(rel);
+
+        for (const auto &uri : uris)
         {
-            predicatesToQuery.insert(inverse);
+            m_uriToRelation[uri] = rel;
         }
     }
 
-    // Add edges for useful predicates
-    for (const auto &p : predicatesToQuery)
+    // Read preorders
+    logger.info("Read preorders");
+    for (const auto &d : dimensions)
+    {
+        switch (d.second.getPreorderName())
+        {
+            case SET_INCLUSION:
+                m_preorders[d.first] = new SetInclusionPreorder();
+                break;
+
+            case INDIVIDUALS:
+                m_preorders[d.first] = new IndividualsPreorder(reader, elements);
+                break;
+
+            case ANNOTATIONS:
+                m_preorders[d.first] = new AnnotationsPreorder(reader, elements);
+                break;
+        }
+    }
+
+    if (!reader.isComplete())
     {
-        // Query edges for given predicate
-        logger.info("Query " + p->getURI() + " edges");
-        std::set<std::pair<std::string, std::string>> edges = serverManager.queryTwoElements("?e1 <" + p->getURI() + "> ?e2");
+        logger.critical("Snapshot has unexpected trailing data, run the ingest phase again");
+        std::exit(-1);
+    }
 
-        // Add edges to individuals
-        logger.info("Build " + p->getURI() + " adjacency from edges");
+    logger.info("Found " + std::to_string(m_relations.size()) + " relations");
+}
 
-        boost::progress_display progressBar(edges.size());
-        for (const auto &e : edges)
-        {
-            Individual *i1 = individualsSet.getIndividualFromURI(e.first);
-            Individual *i2 = individualsSet.getIndividualFromURI(e.second);
+RelationsReconcilier::~RelationsReconcilier()
+{
+    for (const auto &r : m_relations)
+    {
+        delete r;
+    }
 
-            i1->addEdge(p, i2);
+    for (const auto &el : m_relationElements)
+    {
+        delete el;
+    }
 
-            // Add edges for inverses
-            for (const auto &pInv : p->getInverses())
+    for (const auto &p : m_preorders)
+    {
+        delete p.second;
+    }
+}
+
+void RelationsReconcilier::addEdges(IndividualsSet &individualsSet, const TriplestoreManager &triplestoreManager,
+                                    const IngestionPlanner &ingestionPlanner, const Configuration &parameters,
+                                    const Logger &logger)
+{
+    // Add rdfs:subClassOf edges already queried by the planner
+    Predicate *subClassOf = m_predicatesSet.getPredicateFromUri("http://www.w3.org/2000/01/rdf-schema#subClassOf");
+    const std::vector<ImpliedEdge> &subClassOfEdges = m_predicatesSet.getImpliedEdges(subClassOf);
+    for (const auto &e : ingestionPlanner.getSubClassOfEdges())
+    {
+        addEdge(individualsSet, subClassOfEdges, individualsSet.getIndividualFromURI(e.first), individualsSet.getIndividualFromURI(e.second));
+    }
+
+    // Useful predicates, grouped by the scope of their edges to query
+    // Edges are added while later pages are still fetched and parsed (see TriplestoreManager::queryRowsPipelined)
+    auto capacity = static_cast<unsigned long>(parameters.getPipelineCapacity());
+    for (const auto &scope : ingestionPlanner.getEdgesScopes(m_predicatesSet))
+    {
+        const std::set<Predicate*> &predicatesToQuery = scope.second;
+
+        if (parameters.isBatchedEdges())
+        {
+            // Query edges of all useful predicates in a single paged stream
+            std::map<std::string, const std::vector<ImpliedEdge>*> uriToPredicate;
+            std::string whereClause("VALUES ?p {");
+            for (const auto &p : predicatesToQuery)
             {
-                i2->addEdge(pInv, i1);
+                uriToPredicate[p->getURI()] = &m_predicatesSet.getImpliedEdges(p);
+                whereClause += " <" + p->getURI() + ">";
             }
 
-            // Add edges for ancestors (and their inverses)
-            for (const auto &pAncestor : p->getAncestors())
-            {
-                i1->addEdge(pAncestor, i2);
+            whereClause += " } ?e1 ?p ?e2" + scope.first;
 
-                for (const auto &pAncestorInv : pAncestor->getInverses())
+            logger.info("Query edges of " + std::to_string(predicatesToQuery.size()) + " predicates");
+            unsigned long edgesCount(0);
+
+            triplestoreManager.queryRowsPipelined({"e1", "p", "e2"}, whereClause,
+                                    [&individualsSet, &uriToPredicate, &edgesCount](const std::vector<std::string> &row) {
+                auto it = uriToPredicate.find(row[1]);
+                if (it != uriToPredicate.end())
                 {
-                    i2->addEdge(pAncestorInv, i1);
+                    addEdge(individualsSet, *it->second, individualsSet.getIndividualFromURI(row[0]), individualsSet.getIndividualFromURI(row[2]));
+                    edgesCount++;
                 }
-            }
+            }, capacity);
 
-            ++progressBar;
+            logger.info(std::to_string(edgesCount) + " edges added");
+            continue;
+        }
+
+        // Add edges for useful predicates
+        for (const auto &p : predicatesToQuery)
+        {
+            // Query edges for given predicate and add them to individuals
+            logger.info("Query " + p->getURI() + " edges");
+            unsigned long edgesCount(0);
+            const std::vector<ImpliedEdge> &impliedEdges = m_predicatesSet.getImpliedEdges(p);
+
+            triplestoreManager.queryRowsPipelined({"e1", "e2"}, "?e1 <" + p->getURI() + "> ?e2" + scope.first,
+                                    [&individualsSet, &edgesCount, &impliedEdges](const std::vector<std::string> &row) {
+                addEdge(individualsSet, impliedEdges, individualsSet.getIndividualFromURI(row[0]), individualsSet.getIndividualFromURI(row[1]));
+                edgesCount++;
+            }, capacity);
+
+            logger.info(std::to_string(edgesCount) + " " + p->getURI() + " edges added");
+        }
+    }
+}
+
+void RelationsReconcilier::addEdge(IndividualsSet &individualsSet, const std::vector<ImpliedEdge> &impliedEdges,
+                                   Individual *i1, Individual *i2)
+{
+    // Add the edge, edges for inverses and edges for ancestors (and their inverses)
+    for (const auto &e : impliedEdges)
+    {
+        if (e.second)
+        {
+            individualsSet.addEdge(e.first, i2, i1);
+        }
+
+        else
+        {
+            individualsSet.addEdge(e.first, i1, i2);
         }
     }
 }
@@ -111,16 +247,17 @@ void RelationsReconcilier::buildRelationsAndPreorders(IndividualsSet &individual
 {
     Predicate *type = m_predicatesSet.getPredicateFromUri("http://www.w3.org/1999/02/22-rdf-syntax-ns#type");
     Predicate *subClassOf = m_predicatesSet.getPredicateFromUri("http://www.w3.org/2000/01/rdf-schema#subClassOf");
+    InstancesIndex instancesIndex(individualsSet, type, subClassOf);
 
     // Detect dimension instances
     logger.info("Detect dimension instances");
-    std::map<std::string, std::set<Individual*>> dimensionInstances;
+    std::map<std::string, Bitmap> dimensionInstances;
     for (const auto &d : parameters.getDimensions())
     {
+        Bitmap &instances = dimensionInstances[d.first];
         for (const auto &uri : d.second.getIndividualTypes())
         {
-            std::set<Individual*> instances(individualsSet.getIndividualFromURI(uri)->getInstances(type, subClassOf));
-            dimensionInstances[d.first].insert(instances.begin(), instances.end());
+            instances.unite(instancesIndex.getInstances(individualsSet.getIndividualFromURI(uri)));
         }
     }
 
@@ -136,12 +273,14 @@ void RelationsReconcilier::buildRelationsAndPreorders(IndividualsSet &individual
         Individual *relType = individualsSet.getIndividualFromURI(relTypeUri);
 
         logger.info("Get instances");
-        std::set<Individual*> instances = relType->getInstances(type, subClassOf);
+        std::vector<unsigned int> instances = instancesIndex.getInstances(relType).getElements();
 
         logger.info("Transform instances in relations");
         boost::progress_display progressBar(instances.size());
-        for (const auto &relInd : instances)
+        for (const auto &index : instances)
         {
+            Individual *relInd = individualsSet.getIndividual(index);
+
             // If this individual is not associated to a relation => this is a new relation to add
             if (indToRel.find(relInd) == indToRel.end())
             {
@@ -221,14 +360,12 @@ void RelationsReconcilier::buildRelationsAndPreorders(IndividualsSet &individual
     logger.info("Add dimension types to relation elements");
     for (const auto &d : parameters.getDimensions())
     {
-        for (const auto &uri : d.second.getIndividualTypes())
+        const Bitmap &instances = dimensionInstances[d.first];
+        for (const auto &i2e : indToEl)
         {
-            for (const auto &i : individualsSet.getIndividualFromURI(uri)->getInstances(type, subClassOf))
+            if (instances.test(i2e.first->getIndex()))
             {
-                if (indToEl.find(i)  != indToEl.end())
-                {
-                    indToEl[i]->addInDimension(d.first);
-                }
+                i2e.second->addInDimension(d.first);
             }
         }
     }
@@ -237,28 +374,180 @@ void RelationsReconcilier::buildRelationsAndPreorders(IndividualsSet &individual
     logger.info("Found " + std::to_string(m_relations.size()) + " relations");
 }
 
+void RelationsReconcilier::writeSnapshot(SnapshotWriter &writer, const Configuration &parameters) const
+{
+    // Dimensions and their preorders
+    std::map<std::string, const DimensionConfiguration> dimensions = parameters.getDimensions();
+    writer.writeUInt32(static_cast<unsigned int>(dimensions.size()));
+    for (const auto &d : dimensions)
+    {
+        writer.writeString(d.first);
+        writer.writeUInt32(static_cast<unsigned int>(d.second.getPreorderName()));
+    }
+
+    // Relation elements, referenced by their index in the rest of the snapshot
+    std::map<RelationElement*, unsigned int> elementIds;
+    writer.writeUInt32(static_cast<unsigned int>(m_relationElements.size()));
+    for (const auto &el : m_relationElements)
+    {
+        elementIds.emplace(el, static_cast<unsigned int>(elementIds.size()));
+        writer.writeStrings(URIsInterner::getURIs(el->getURIs()));
+        writer.writeStrings(el->getInDimensions());
+    }
+
+    for (const auto &el : m_relationElements)
+    {
+        std::map<std::string, std::set<RelationElement*>> dependencies = el->getDependencies();
+        writer.writeUInt32(static_cast<unsigned int>(dependencies.size()));
+        for (const auto &d2deps : dependencies)
+        {
+            writer.writeString(d2deps.first);
+            Preorder::writeElements(writer, d2deps.second, elementIds);
+        }
+    }
+
+    // Relations
+    writer.writeUInt32(static_cast<unsigned int>(m_relations.size()));
+    for (const auto &rel : m_relations)
+    {
+        writer.writeStrings(URIsInterner::getURIs(rel->getURIs()));
+
+        const std::map<std::pair<std::string, Predicate*>, std::set<RelationElement*>> &relDimensions = rel->getDimensions();
+        writer.writeUInt32(static_cast<unsigned int>(relDimensions.size()));
+        for (const auto &d : relDimensions)
+        {
+            writer.writeString(d.first.first);
+            writer.writeString(d.first.second->getURI());
+            Preorder::writeElements(writer, d.second, elementIds);
+        }
+    }
+
+    // Preorders
+    for (const auto &d : dimensions)
+    {
+        m_preorders.at(d.first)->writeSnapshot(writer, elementIds);
+    }
+}
+
+void RelationsReconcilier::indexDimensions(const Logger &logger)
+{
+    // Dimensions of all relations, grouped by preorder
+    logger.info("Index dimensions of relations");
+    std::map<std::string, std::vector<const std::set<RelationElement*>*>> dimensions;
+    for (const auto &rel : m_relations)
+    {
+        for (const auto &d : rel->getDimensions())
+        {
+            dimensions[d.first.first].push_back(&d.second);
+        }
+    }
+
+    for (const auto &d : dimensions)
+    {
+        m_preorders.at(d.first)->indexDimensions(d.second);
+    }
+
+    // Signatures of the non-empty dimensions and aggregated dimensions of relations, with masks in the order of their
+    // keys and of the preorders
+    logger.info("Compute signatures of relations");
+    for (const auto &rel : m_relations)
+    {
+        const std::map<std::pair<std::string, Predicate*>, std::set<RelationElement*>> &relDimensions = rel->getDimensions();
+        std::vector<DimensionSignature> relSignatures;
+        std::vector<std::uint64_t> nonEmpty((relDimensions.size() + 63) / 64);
+        unsigned long k(0);
+        for (const auto &d : relDimensions)
+        {
+            if (!d.second.empty())
+            {
+                nonEmpty[k / 64] |= std::uint64_t(1) << (k % 64);
+                relSignatures.push_back(m_preorders.at(d.first.first)->getSignature(d.second));
+            }
+
+            k++;
+        }
+
+        std::map<std::string, std::set<RelationElement*>> aggregatedDimensions = rel->getAggregatedDimensions();
+        std::vector<DimensionSignature> aggregatedSignatures;
+        std::vector<std::uint64_t> aggregatedNonEmpty((m_preorders.size() + 63) / 64);
+        k = 0;
+        for (const auto &p : m_preorders)
+        {
+            auto d = aggregatedDimensions.find(p.first);
+            if (d != aggregatedDimensions.end() && !d->second.empty())
+            {
+                aggregatedNonEmpty[k / 64] |= std::uint64_t(1) << (k % 64);
+                aggregatedSignatures.push_back(p.second->getSignature(d->second));
+            }
+
+            k++;
+        }
+
+        rel->setSignature(RelationSignature(relSignatures, nonEmpty, aggregatedSignatures, aggregatedNonEmpty));
+    }
+
+    // Relations often share the same dimensions: their comparisons are memoized between interned dimensions
+    logger.info("Intern dimensions of relations");
+    const std::set<RelationElement*> emptyDimension;
+    for (const auto &rel : m_relations)
+    {
+        std::vector<unsigned int> dimensionSets;
+        for (const auto &d : rel->getDimensions())
+        {
+            dimensionSets.push_back(m_dimensionSets.getId(d.second));
+        }
+
+        std::map<std::string, std::set<RelationElement*>> aggregatedDimensions = rel->getAggregatedDimensions();
+        std::vector<unsigned int> aggregatedDimensionSets;
+        for (const auto &p : m_preorders)
+        {
+            auto d = aggregatedDimensions.find(p.first);
+            aggregatedDimensionSets.push_back(m_dimensionSets.getId(d != aggregatedDimensions.end() ? d->second : emptyDimension));
+        }
+
+        rel->setDimensionSets(std::move(dimensionSets), std::move(aggregatedDimensionSets));
+    }
+
+    logger.info(std::to_string(m_dimensionSets.size()) + " distinct dimensions");
+}
+
+bool RelationsReconcilier::comparesAggregatedDimensions(const Configuration &parameters)
+{
+    return parameters.getNonEmptyDimensionLimit() >= 0 &&
+           (parameters.getSimilarityLimit() >= 0.0 || parameters.getComparableDimensionLimit() >= 0);
+}
+
+bool RelationsReconcilier::relatesWithoutComparableElements(const Configuration &parameters)
+{
+    // A similarity or a number of comparable aggregated dimensions at least 0 holds without comparable elements
+    return comparesAggregatedDimensions(parameters) &&
+           ((parameters.getSimilarityLimit() >= 0.0 && parameters.getSimilarityLimit() <= 0.0) ||
+            parameters.getComparableDimensionLimit() == 0);
+}
+
 void RelationsReconcilier::reconcileExplained(const std::string &uri1, const std::string &uri2, std::ofstream &outputStream, const Configuration &parameters)
 {
-    if (m_uriToRelation.find(uri1) == m_uriToRelation.end())
+    URIId id1(0), id2(0);
+    if (!URIsInterner::findId(uri1, id1) || m_uriToRelation.find(id1) == m_uriToRelation.end())
     {
         throw RelationNotFound(uri1 + " not found as relation");
     }
 
-    if (m_uriToRelation.find(uri2) == m_uriToRelation.end())
+    if (!URIsInterner::findId(uri2, id2) || m_uriToRelation.find(id2) == m_uriToRelation.end())
     {
         throw RelationNotFound(uri2 + " not found as relation");
     }
 
-    Relation *r1 = m_uriToRelation[uri1];
-    Relation *r2 = m_uriToRelation[uri2];
+    Relation *r1 = m_uriToRelation[id1];
+    Relation *r2 = m_uriToRelation[id2];
 
     outputStream << "===================RECONCILIATION RESULTS====================" << std::endl;
     outputStream << "RELATION 1:" << std::endl << r1->toString() << std::endl;
     outputStream << "RELATION 2:" << std::endl << r2->toString() << std::endl;
     outputStream << "RESULTS:" << std::endl;
 
-    const std::map<std::pair<std::string, Predicate*>, std::set<RelationElement*>> dimR1 = r1->getDimensions();
-    const std::map<std::pair<std::string, Predicate*>, std::set<RelationElement*>> dimR2 = r2->getDimensions();
+    const std::map<std::pair<std::string, Predicate*>, std::set<RelationElement*>> &dimR1 = r1->getDimensions();
+    const std::map<std::pair<std::string, Predicate*>, std::set<RelationElement*>> &dimR2 = r2->getDimensions();
 
     OrderResult result(EQUAL);
     int count1DimEmpty(0);
@@ -285,7 +574,7 @@ void RelationsReconcilier::reconcileExplained(const std::string &uri1, const std
         result = INCOMPARABLE;
     }
 
-    if (result == INCOMPARABLE && parameters.getNonEmptyDimensionLimit() >= 0 && (parameters.getSimilarityLimit() >= 0.0 || parameters.getComparableDimensionLimit() >= 0))
+    if (result == INCOMPARABLE && comparesAggregatedDimensions(parameters))
     {
         outputStream << "AGGREGATED COMPARISON + INCLUSION OF DEPENDENCIES" << std::endl;
 
@@ -336,19 +625,134 @@ void RelationsReconcilier::reconcileExplained(const std::string &uri1, const std
     outputStream << "=============================================================" << std::endl << std::endl << std::endl;
 }
 
-void RelationsReconcilier::reconcileBatch(TTLWriter &ttlWriter, const Configuration &parameters)
+std::vector<std::vector<unsigned long>> RelationsReconcilier::getCandidatePairs(const Configuration &parameters,
+                                                                               const Logger &logger) const
 {
-    unsigned long comparisonNumber(m_relations.size() * (m_relations.size() - 1) / 2);
+    // Candidates j > i of each relation i: a superset of the pairs whose reconciliation is not INCOMPARABLE
+    std::vector<std::vector<unsigned long>> candidates(m_relations.size());
+
+    // The aggregated comparison can relate pairs without comparable elements if a limit is 0: all pairs are candidates
+    if (relatesWithoutComparableElements(parameters))
+    {
+        logger.info("Candidate pairs: all pairs");
+        for (unsigned long i = 0; i < m_relations.size(); i++)
+        {
+            for (unsigned long j = i + 1; j < m_relations.size(); j++)
+            {
+                candidates[i].push_back(j);
+            }
+        }
+
+        return candidates;
+    }
+
+    // A pair is not INCOMPARABLE only if both relations share a token in an aggregated dimension (comparable elements),
+    // or if one of them has only empty dimensions. Relations with only empty dimensions, or without necessary tokens,
+    // are candidates with all relations
+    logger.info("Index tokens of dimensions");
+    std::map<std::string, std::unordered_map<RelationElement*, std::vector<unsigned long>>> postings;
+    std::vector<std::map<std::string, std::set<RelationElement*>>> probes(m_relations.size());
+    std::vector<unsigned long> universal;
+
+    for (unsigned long i = 0; i < m_relations.size(); i++)
+    {
+        bool isUniversal(true);
+        for (const auto &d : m_relations[i]->getDimensions())
+        {
+            isUniversal = isUniversal && d.second.empty();
+        }
+
+        for (const auto &d : m_relations[i]->getAggregatedDimensions())
+        {
+            std::set<RelationElement*> posted;
+            if (!m_preorders.at(d.first)->getTokens(d.second, probes[i][d.first], posted))
+            {
+                isUniversal = true;
+            }
+
+            for (const auto &token : posted)
+            {
+                postings[d.first][token].push_back(i);
+            }
+        }
+
+        if (isUniversal)
+        {
+            universal.push_back(i);
+        }
+    }
+
+    logger.info("Generate candidate pairs");
+    for (unsigned long i = 0; i < m_relations.size(); i++)
+    {
+        for (const auto &d2t : probes[i])
+        {
+            const std::unordered_map<RelationElement*, std::vector<unsigned long>> &dimensionPostings = postings[d2t.first];
+            for (const auto &token : d2t.second)
+            {
+                auto it = dimensionPostings.find(token);
+                if (it == dimensionPostings.end())
+                {
+                    continue;
+                }
+
+                for (const auto &j : it->second)
+                {
+                    if (i != j)
+                    {
+                        candidates[std::min(i, j)].push_back(std::max(i, j));
+                    }
+                }
+            }
+        }
+
+        probes[i].clear();
+    }
+
+    for (const auto &i : universal)
+    {
+        for (unsigned long j = 0; j < m_relations.size(); j++)
+        {
+            if (i != j)
+            {
+                candidates[std::min(i, j)].push_back(std::max(i, j));
+            }
+        }
+    }
+
+    // Pairs are reconciled in the same order as all pairs would be
+    unsigned long candidatesCount(0);
+    for (auto &c : candidates)
+    {
+        std::sort(c.begin(), c.end());
+        c.erase(std::unique(c.begin(), c.end()), c.end());
+        candidatesCount += c.size();
+    }
+
+    logger.info(std::to_string(candidatesCount) + " candidate pairs out of " +
+                std::to_string(m_relations.size() * (m_relations.size() - 1) / 2));
+    return candidates;
+}
+
+void RelationsReconcilier::reconcileBatch(TTLWriter &ttlWriter, const Configuration &parameters, const Logger &logger)
+{
+    std::vector<std::vector<unsigned long>> candidates(getCandidatePairs(parameters, logger));
+    unsigned long comparisonNumber(0);
+    for (const auto &c : candidates)
+    {
+        comparisonNumber += c.size();
+    }
+
     boost::progress_display progressBar(comparisonNumber);
 
     #pragma omp parallel for default(shared) num_threads(parameters.getThreadsNumber()) schedule(dynamic)
     for (unsigned long i = 0; i < m_relations.size(); i++)
     {
-        for (unsigned long j = i + 1; j < m_relations.size(); j++)
+        for (const auto &j : candidates[i])
         {
             OrderResult result(reconcile(m_relations[i], m_relations[j], parameters));
-            std::string uri1 = *(m_relations[i]->getURIs().begin());
-            std::string uri2 = *(m_relations[j]->getURIs().begin());
+            std::string uri1 = m_relations[i]->getURI();
+            std::string uri2 = m_relations[j]->getURI();
 
             if (result == EQUAL && !parameters.getOutputPredEqual().empty())
             {
@@ -407,17 +811,41 @@ void RelationsReconcilier::reconcileBatch(TTLWriter &ttlWriter, const Configurat
 
 OrderResult RelationsReconcilier::reconcile(Relation *r1, Relation *r2, const Configuration &parameters)
 {
-    const std::map<std::pair<std::string, Predicate*>, std::set<RelationElement*>> dimR1 = r1->getDimensions();
-    const std::map<std::pair<std::string, Predicate*>, std::set<RelationElement*>> dimR2 = r2->getDimensions();
+    const std::map<std::pair<std::string, Predicate*>, std::set<RelationElement*>> &dimR1 = r1->getDimensions();
+    const std::map<std::pair<std::string, Predicate*>, std::set<RelationElement*>> &dimR2 = r2->getDimensions();
 
     OrderResult result(EQUAL);
     int count1DimEmpty(0);
     auto it(dimR1.begin());
 
+    // The signatures reject pairs which are incomparable on their dimensions, and not related on their aggregated
+    // dimensions, without comparing their elements
+    const RelationSignature &sigR1 = r1->getSignature();
+    const RelationSignature &sigR2 = r2->getSignature();
+    if (!sigR1.mayBeComparable(sigR2))
+    {
+        if (!comparesAggregatedDimensions(parameters) || (!relatesWithoutComparableElements(parameters) &&
+                                                         !sigR1.mayBeRelated(sigR2, parameters.getNonEmptyDimensionLimit())))
+        {
+            return INCOMPARABLE;
+        }
+
+        result = INCOMPARABLE;
+    }
+
+    // Interned dimensions are compared through the memo (when both are shared, otherwise the pair is unlikely to be
+    // compared again), in the same order for both relations
+    const std::vector<unsigned int> &setsR1 = r1->getDimensionSets();
+    const std::vector<unsigned int> &setsR2 = r2->getDimensionSets();
+    bool interned(setsR1.size() == dimR1.size() && setsR2.size() == dimR2.size() && dimR1.size() == dimR2.size());
+    unsigned long k(0);
+
     while (it != dimR1.end() && result != INCOMPARABLE)
     {
         Preorder *preorder = m_preorders[it->first.first];
-        OrderResult dimResult = preorder->compare(dimR1.at(it->first), dimR2.at(it->first));
+        OrderResult dimResult = (interned && m_dimensionSets.isShared(setsR1[k]) && m_dimensionSets.isShared(setsR2[k])) ?
+                m_comparisonsMemo.compare(preorder, setsR1[k], setsR2[k], dimR1.at(it->first), dimR2.at(it->first)) :
+                preorder->compare(dimR1.at(it->first), dimR2.at(it->first));
         result &= dimResult;
 
         if ((dimR1.at(it->first).empty() && !dimR2.at(it->first).empty()) || (!dimR1.at(it->first).empty() && dimR2.at(it->first).empty()))
@@ -426,6 +854,7 @@ OrderResult RelationsReconcilier::reconcile(Relation *r1, Relation *r2, const Co
         }
 
         it++;
+        k++;
     }
 
     if (result == COMPARABLE && count1DimEmpty != 0)
@@ -433,19 +862,46 @@ OrderResult RelationsReconcilier::reconcile(Relation *r1, Relation *r2, const Co
         result = INCOMPARABLE;
     }
 
-    if (result == INCOMPARABLE && parameters.getNonEmptyDimensionLimit() >= 0 && (parameters.getSimilarityLimit() >= 0.0 || parameters.getComparableDimensionLimit() >= 0))
+    if (result == INCOMPARABLE && comparesAggregatedDimensions(parameters))
     {
-        std::map<std::string, std::set<RelationElement*>> aggDimR1 = r1->getAggregatedDimensions();
-        std::map<std::string, std::set<RelationElement*>> aggDimR2 = r2->getAggregatedDimensions();
+        const std::vector<unsigned int> &aggSetsR1 = r1->getAggregatedDimensionSets();
+        const std::vector<unsigned int> &aggSetsR2 = r2->getAggregatedDimensionSets();
 
         std::vector<double> jacquardResults;
-        for (const auto &d1 : aggDimR1)
+        if (aggSetsR1.size() == m_preorders.size() && aggSetsR2.size() == m_preorders.size())
         {
-            if (!aggDimR1.at(d1.first).empty() && !aggDimR2.at(d1.first).empty())
+            // Interned aggregated dimensions, in the order of the preorders (names of the aggregated dimensions)
+            k = 0;
+            for (const auto &p : m_preorders)
             {
-                Preorder *preorder = m_preorders[d1.first];
-                double dimJacquard = preorder->incomparableJacquard(aggDimR1.at(d1.first), aggDimR2.at(d1.first));
-                jacquardResults.push_back(dimJacquard);
+                const std::set<RelationElement*> &aggDim1 = m_dimensionSets.getSet(aggSetsR1[k]);
+                const std::set<RelationElement*> &aggDim2 = m_dimensionSets.getSet(aggSetsR2[k]);
+                if (!aggDim1.empty() && !aggDim2.empty())
+                {
+                    jacquardResults.push_back(
+                            (m_dimensionSets.isShared(aggSetsR1[k]) && m_dimensionSets.isShared(aggSetsR2[k])) ?
+                            m_comparisonsMemo.incomparableJacquard(p.second, aggSetsR1[k], aggSetsR2[k], aggDim1,
+                                                                   aggDim2) :
+                            p.second->incomparableJacquard(aggDim1, aggDim2));
+                }
+
+                k++;
+            }
+        }
+
+        else
+        {
+            std::map<std::string, std::set<RelationElement*>> aggDimR1 = r1->getAggregatedDimensions();
+            std::map<std::string, std::set<RelationElement*>> aggDimR2 = r2->getAggregatedDimensions();
+
+            for (const auto &d1 : aggDimR1)
+            {
+                if (!aggDimR1.at(d1.first).empty() && !aggDimR2.at(d1.first).empty())
+                {
+                    Preorder *preorder = m_preorders[d1.first];
+                    double dimJacquard = preorder->incomparableJacquard(aggDimR1.at(d1.first), aggDimR2.at(d1.first));
+                    jacquardResults.push_back(dimJacquard);
+                }
             }
         }
 
@@ -6,43 +6,61 @@
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "../configuration/Configuration.h"
 #include "../io/Logger.h"
-#include "../io/ServerManager.h"
+#include "../io/SnapshotReader.h"
+#include "../io/SnapshotWriter.h"
+#include "../io/TriplestoreManager.h"
 #include "../io/TTLWriter.h"
+#include "../model/ElementSetsInterner.h"
 #include "../model/IndividualsSet.h"
 #include "../model/Predicate.h"
 #include "../model/PredicatesSet.h"
 #include "../model/Relation.h"
 #include "../model/RelationElement.h"
+#include "ComparisonsMemo.h"
+#include "IngestionPlanner.h"
 #include "Preorder.h"
 
 class RelationsReconcilier
 {
     public:
-        RelationsReconcilier(const ServerManager &serverManager, const Configuration &parameters, const Logger &logger);
+        RelationsReconcilier(const TriplestoreManager &triplestoreManager, const Configuration &parameters, const Logger &logger);
+        RelationsReconcilier(SnapshotReader &reader, const Configuration &parameters, const Logger &logger);
         ~RelationsReconcilier();
+        void writeSnapshot(SnapshotWriter &writer, const Configuration &parameters) const;
+        void indexDimensions(const Logger &logger);
         void reconcileExplained(const std::string &uri1, const std::string &uri2, std::ofstream &outputStream, const Configuration &parameters);
-        void reconcileBatch(TTLWriter &ttlWriter, const Configuration &parameters);
+        void reconcileBatch(TTLWriter &ttlWriter, const Configuration &parameters, const Logger &logger);
 
     private:
-        void addEdges(IndividualsSet &individualsSet, const ServerManager &serverManager,
-                      const Configuration &parameters, const Logger &logger);
+        void addEdges(IndividualsSet &individualsSet, const TriplestoreManager &triplestoreManager,
+                      const IngestionPlanner &ingestionPlanner, const Configuration &parameters, const Logger &logger);
+        static void addEdge(IndividualsSet &individualsSet, const std::vector<ImpliedEdge> &impliedEdges,
+                            Individual *i1, Individual *i2);
         void buildRelationsAndPreorders(IndividualsSet &individualsSet, const Configuration &parameters,
                                         const Logger &logger);
+        std::vector<std::vector<unsigned long>> getCandidatePairs(const Configuration &parameters, const Logger &logger) const;
         OrderResult reconcile(Relation *r1, Relation *r2, const Configuration &parameters);
+        static bool comparesAggregatedDimensions(const Configuration &parameters);
+        static bool relatesWithoutComparableElements(const Configuration &parameters);
         static void printAggregatedDimension(const std::map<std::string, std::set<RelationElement*>> &aggDimensions, std::ofstream &outputStream);
 
         PredicatesSet m_predicatesSet;
 
         std::vector<Relation*> m_relations;
-        std::map<std::string, Relation*> m_uriToRelation;
+        std::unordered_map<URIId, Relation*> m_uriToRelation;
 
         std::set<RelationElement*> m_relationElements;
 
         std::map<std::string, Preorder*> m_preorders;
+
+        // Interned dimensions of relations, and memoized comparisons between them for the batch reconciliation
+        ElementSetsInterner m_dimensionSets;
+        ComparisonsMemo m_comparisonsMemo;
 };
 
 
@@ -10,6 +10,15 @@ SetInclusionPreorder::SetInclusionPreorder() : Preorder()
 SetInclusionPreorder::~SetInclusionPreorder()
 = default;
 
+bool SetInclusionPreorder::getTokens(const std::set<RelationElement*> &dim, std::set<RelationElement*> &probed,
+                                     std::set<RelationElement*> &posted) const
+{
+    // An element is only below itself
+    probed = dim;
+    posted = dim;
+    return true;
+}
+
 bool SetInclusionPreorder::isLeq(const std::set<RelationElement*> &dim1, const std::set<RelationElement*> &dim2) const
 {
     return std::includes(dim2.begin(), dim2.end(), dim1.begin(), dim1.end());
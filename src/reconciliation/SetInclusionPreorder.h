@@ -11,6 +11,8 @@ class SetInclusionPreorder : public Preorder
     public:
         SetInclusionPreorder();
         virtual ~SetInclusionPreorder();
+        virtual bool getTokens(const std::set<RelationElement*> &dim, std::set<RelationElement*> &probed,
+                               std::set<RelationElement*> &posted) const;
 
     protected:
         virtual bool isLeq(const std::set<RelationElement*> &dim1, const std::set<RelationElement*> &dim2) const;
@@ -0,0 +1,221 @@
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+#include <thread>
+#include <utility>
+
+#include "ReplayServer.h"
+
+// Bytes written at once when the bandwidth is limited
+#define REPLAY_CHUNK_SIZE 4096
+
+
+ReplayServer::ReplayServer(const QueryRecorder &recorder, std::string queryAttribute, int latency, int bandwidth,
+                           Logger const &logger) : m_recorder(recorder), m_queryAttribute(std::move(queryAttribute)),
+                                                   m_latency(std::max(latency, 0)),
+                                                   m_bandwidth(std::max(bandwidth, 0) * 1024L), m_logger(logger)
+{
+
+}
+
+void ReplayServer::run(unsigned short port)
+{
+    boost::asio::io_context ioContext;
+    boost::asio::ip::tcp::acceptor acceptor(ioContext, {boost::asio::ip::tcp::v4(), port});
+    m_logger.info("Replay server listening on port " + std::to_string(port));
+
+    while (true)
+    {
+        boost::asio::ip::tcp::socket socket(ioContext);
+        acceptor.accept(socket);
+        std::thread(&ReplayServer::serve, this, std::move(socket)).detach();
+    }
+}
+
+void ReplayServer::serve(boost::asio::ip::tcp::socket socket) const
+{
+    boost::asio::streambuf buffer;
+
+    try
+    {
+        while (handleRequest(socket, buffer));
+    }
+
+    catch (const boost::system::system_error &e)
+    {
+        // Connection closed by the client
+        if (e.code() != boost::asio::error::eof && e.code() != boost::asio::error::connection_reset)
+        {
+            m_logger.error("Connection error: " + std::string(e.what()));
+        }
+    }
+}
+
+bool ReplayServer::handleRequest(boost::asio::ip::tcp::socket &socket, boost::asio::streambuf &buffer) const
+{
+    unsigned long headerSize = boost::asio::read_until(socket, buffer, "\r\n\r\n");
+    std::string header(boost::asio::buffers_begin(buffer.data()), boost::asio::buffers_begin(buffer.data()) + headerSize);
+    buffer.consume(headerSize);
+
+    std::istringstream headerStream(header);
+    std::string method, target, version;
+    headerStream >> method >> target >> version;
+    std::map<std::string, std::string> headers = parseHeaders(headerStream);
+
+    bool keepAlive = (headers["connection"] != "close");
+
+    unsigned long bodySize(0);
+    if (!headers["content-length"].empty())
+    {
+        bodySize = std::stoul(headers["content-length"]);
+    }
+
+    // libcurl waits for an interim response before sending large bodies
+    if (bodySize > 0 && headers["expect"] == "100-continue")
+    {
+        boost::asio::write(socket, boost::asio::buffer(std::string("HTTP/1.1 100 Continue\r\n\r\n")));
+    }
+
+    if (buffer.size() < bodySize)
+    {
+        boost::asio::read(socket, buffer, boost::asio::transfer_exactly(bodySize - buffer.size()));
+    }
+
+    std::string body(boost::asio::buffers_begin(buffer.data()), boost::asio::buffers_begin(buffer.data()) + bodySize);
+    buffer.consume(bodySize);
+
+    // The query is either a parameter of the URL, the body of the request or a parameter of a form
+    std::string query;
+    auto separator = target.find('?');
+    if (separator != std::string::npos)
+    {
+        query = findQuery(target.substr(separator + 1));
+    }
+
+    if (method == "POST")
+    {
+        if (headers["content-type"].compare(0, 24, "application/sparql-query") == 0)
+        {
+            query = body;
+        }
+
+        else if (headers["content-type"].compare(0, 33, "application/x-www-form-urlencoded") == 0)
+        {
+            query = findQuery(body);
+        }
+    }
+
+    std::string contentType, response;
+    if (query.empty())
+    {
+        respond(socket, "400 Bad Request", "text/plain", "No query", keepAlive);
+    }
+
+    else if (m_recorder.find(query, contentType, response))
+    {
+        respond(socket, "200 OK", contentType, response, keepAlive);
+    }
+
+    else
+    {
+        m_logger.warning("No record for query " + QueryRecorder::getKey(query) + ": " + query);
+        respond(socket, "404 Not Found", "text/plain", "No record", keepAlive);
+    }
+
+    return keepAlive;
+}
+
+void ReplayServer::respond(boost::asio::ip::tcp::socket &socket, const std::string &status,
+                           const std::string &contentType, const std::string &body, bool keepAlive) const
+{
+    auto start = std::chrono::steady_clock::now() + std::chrono::milliseconds(m_latency);
+    std::this_thread::sleep_until(start);
+
+    std::string header = "HTTP/1.1 " + status + "\r\n"
+            + "Content-Type: " + contentType + "\r\n"
+            + "Content-Length: " + std::to_string(body.size()) + "\r\n"
+            + "Connection: " + (keepAlive ? "keep-alive" : "close") + "\r\n\r\n";
+    boost::asio::write(socket, boost::asio::buffer(header));
+
+    if (m_bandwidth == 0)
+    {
+        boost::asio::write(socket, boost::asio::buffer(body));
+        return;
+    }
+
+    // Each chunk is written once the previous ones would have been received at the given bandwidth
+    for (unsigned long written = 0; written < body.size(); written += REPLAY_CHUNK_SIZE)
+    {
+        std::this_thread::sleep_until(start + std::chrono::microseconds(written * 1000000 / m_bandwidth));
+        unsigned long size = std::min(static_cast<unsigned long>(REPLAY_CHUNK_SIZE), body.size() - written);
+        boost::asio::write(socket, boost::asio::buffer(body.data() + written, size));
+    }
+}
+
+std::string ReplayServer::findQuery(const std::string &parameters) const
+{
+    std::istringstream parametersStream(parameters);
+    std::string parameter;
+
+    while (std::getline(parametersStream, parameter, '&'))
+    {
+        auto separator = parameter.find('=');
+        if (separator != std::string::npos && decodeUrl(parameter.substr(0, separator)) == m_queryAttribute)
+        {
+            return decodeUrl(parameter.substr(separator + 1));
+        }
+    }
+
+    return "";
+}
+
+std::map<std::string, std::string> ReplayServer::parseHeaders(std::istream &stream)
+{
+    // Names are lower-cased, values are trimmed
+    std::map<std::string, std::string> headers;
+    std::string line;
+
+    while (std::getline(stream, line))
+    {
+        auto separator = line.find(':');
+        if (separator == std::string::npos)
+        {
+            continue;
+        }
+
+        std::string name = line.substr(0, separator);
+        std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+
+        auto begin = line.find_first_not_of(" \t", separator + 1);
+        auto end = line.find_last_not_of(" \t\r");
+        headers[name] = (begin == std::string::npos) ? "" : line.substr(begin, end - begin + 1);
+    }
+
+    return headers;
+}
+
+std::string ReplayServer::decodeUrl(const std::string &value)
+{
+    std::string decoded;
+
+    for (unsigned long i = 0; i < value.size(); i++)
+    {
+        if (value[i] == '+')
+        {
+            decoded += ' ';
+        }
+
+        else if (value[i] == '%' && i + 2 < value.size())
+        {
+            decoded += static_cast<char>(std::stoi(value.substr(i + 1, 2), nullptr, 16));
+            i += 2;
+        }
+
+        else
+        {
+            decoded += value[i];
+        }
+    }
+
+    return decoded;
+}
@@ -0,0 +1,42 @@
+#ifndef TCN3R_REPLAYSERVER_H
+#define TCN3R_REPLAYSERVER_H
+
+
+#include <map>
+#include <string>
+
+#include <boost/asio.hpp>
+
+#include "../io/Logger.h"
+#include "../io/QueryRecorder.h"
+
+// Local HTTP stand-in of a SPARQL endpoint answering the queries recorded by tcn3r (see record-directory), with
+// a simulated latency and bandwidth. Each connection is served by its own thread, with HTTP/1.1 keep-alive
+class ReplayServer
+{
+    public:
+        ReplayServer(const QueryRecorder &recorder, std::string queryAttribute, int latency, int bandwidth,
+                     Logger const &logger);
+        void run(unsigned short port);
+
+    private:
+        void serve(boost::asio::ip::tcp::socket socket) const;
+        bool handleRequest(boost::asio::ip::tcp::socket &socket, boost::asio::streambuf &buffer) const;
+        void respond(boost::asio::ip::tcp::socket &socket, const std::string &status, const std::string &contentType,
+                     const std::string &body, bool keepAlive) const;
+        std::string findQuery(const std::string &parameters) const;
+        static std::map<std::string, std::string> parseHeaders(std::istream &stream);
+        static std::string decodeUrl(const std::string &value);
+
+        const QueryRecorder &m_recorder;
+        std::string m_queryAttribute;
+
+        // Milliseconds before the first byte of each response and bytes per second (0 for unlimited)
+        int m_latency;
+        long m_bandwidth;
+
+        Logger const &m_logger;
+};
+
+
+#endif //TCN3R_REPLAYSERVER_H
@@ -0,0 +1,75 @@
+#include <iostream>
+#include <string>
+
+#include <boost/program_options.hpp>
+
+#include "../io/Logger.h"
+#include "../io/QueryRecorder.h"
+#include "ReplayServer.h"
+
+int main(int argc, char* argv[])
+{
+    Logger logger(INFO);
+    logger.info("tcn3r-replay");
+
+    try
+    {
+        // Define command line arguments and parse command line
+        boost::program_options::options_description argsDesc("tcn3r-replay -- allowed options");
+        argsDesc.add_options()
+                (
+                    "help,h",
+                    "Produce help message"
+                )
+                (
+                    "directory,d",
+                    boost::program_options::value<std::string>()->default_value("records"),
+                    "Directory of the query/response pairs recorded by tcn3r (record-directory)"
+                )
+                (
+                    "port,p",
+                    boost::program_options::value<unsigned short>()->default_value(8890),
+                    "Port to listen to"
+                )
+                (
+                    "query-attribute",
+                    boost::program_options::value<std::string>()->default_value("query"),
+                    "Name of the parameter holding the query (url-query-attribute)"
+                )
+                (
+                    "latency,l",
+                    boost::program_options::value<int>()->default_value(0),
+                    "Milliseconds before the first byte of each response"
+                )
+                (
+                    "bandwidth,b",
+                    boost::program_options::value<int>()->default_value(0),
+                    "Bandwidth of each response in KB/s (0 for unlimited)"
+                )
+                ;
+
+        boost::program_options::variables_map argsParsed;
+        boost::program_options::store(boost::program_options::parse_command_line(argc, argv, argsDesc), argsParsed);
+        boost::program_options::notify(argsParsed);
+
+        if (argsParsed.count("help"))
+        {
+            std::cout << argsDesc << std::endl;
+            return 0;
+        }
+
+        logger.info("Replay records from: " + argsParsed["directory"].as<std::string>());
+        QueryRecorder recorder(argsParsed["directory"].as<std::string>(), logger);
+        ReplayServer server(recorder, argsParsed["query-attribute"].as<std::string>(),
+                            argsParsed["latency"].as<int>(), argsParsed["bandwidth"].as<int>(), logger);
+        server.run(argsParsed["port"].as<unsigned short>());
+    }
+
+    catch (std::exception &e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
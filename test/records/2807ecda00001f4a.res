@@ -0,0 +1,2 @@
+application/sparql-results+json
+{"head": {"vars": ["e1", "e2"]}, "results": {"bindings": [{"e1": {"type": "uri", "value": "http://pgxo.loria.fr/cardiovascular_diseases_inst1"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/cardiovascular_diseases_inst2"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/heart_block_inst2"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/heart_block_inst4"}}]}}
\ No newline at end of file
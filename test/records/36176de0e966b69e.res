@@ -0,0 +1,2 @@
+application/sparql-results+json
+{"head": {"vars": ["e1", "e2"]}, "results": {"bindings": [{"e1": {"type": "uri", "value": "http://pgxo.loria.fr/CYP2C9"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/r1"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/warfarin"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/r1"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/CYP2C9"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/r12"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/warfarin"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/r12"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/CYP2C9"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/r14"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/warfarin"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/r14"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/CYP2C9"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/r15"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/warfarin"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/r15"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/CYP2C9"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/r2"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/warfarin"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/r2"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/CYP2C9"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/r3"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/warfarin"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/r3"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/CYP2C9"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/r4"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/warfarin"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/r4"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/CYP2C9"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/r5"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/warfarin"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/r5"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/CYP2C9"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/r6"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/warfarin"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/r6"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/CYP2C9"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/r7"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/warfarin"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/r7"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/CYP2C9"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/r8"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/warfarin"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/r8"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/TPMT"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/r10"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/thiopurine"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/r10"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r1"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/cardiovascular_diseases_inst1"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r2"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/cardiovascular_diseases_inst1"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r10"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/iron_deficiency_anemia"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r11"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/iron_deficiency_anemia"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r12"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/heart_block_inst4"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r14"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/bleeding"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r15"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/heart_block_inst5"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r17"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/ADR10"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r21"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/ADR10"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r17"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/ADR9"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r19"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/ADR1"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r19"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/ADR2"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r19"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/ADR3"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r19"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/ADR5"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r19"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/ADR6"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r19"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/ADR7"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r19"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/ADR8"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r3"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/cardiovascular_diseases_inst2"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r4"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/cardiovascular_diseases_inst3"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r4"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/heart_block_inst1"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r5"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/heart_block_inst1"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r6"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/cardiovascular_diseases_inst4"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r7"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/heart_block_inst2"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r8"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/heart_block_inst3"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r9"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/heart_block_inst3"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r9"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/cardiovascular_diseases_inst5"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/thiopurine"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/r11"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/TPMT*1"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/r11"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/warfarin"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/r9"}}]}}
\ No newline at end of file
@@ -0,0 +1,2 @@
+application/sparql-results+json
+{"head": {"vars": ["e1", "e2"]}, "results": {"bindings": [{"e1": {"type": "uri", "value": "http://pgxo.loria.fr/iron_deficiency_anemia"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/r16"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/thiopurine"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/r16"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r16"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/iron_deficiency_anemia"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r16"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/thiopurine"}}]}}
\ No newline at end of file
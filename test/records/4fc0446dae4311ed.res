@@ -0,0 +1,2 @@
+application/sparql-results+json
+{"head": {"vars": ["e1", "e2"]}, "results": {"bindings": [{"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r18"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/ADR1"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r20"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/ADR2"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r20"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/ADR3"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r20"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/ADR4"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r20"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/ADR5"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r20"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/ADR6"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r20"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/ADR7"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r20"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/ADR8"}}]}}
\ No newline at end of file
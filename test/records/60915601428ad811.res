@@ -0,0 +1,2 @@
+application/sparql-results+json
+{"head": {"vars": ["count"]}, "results": {"bindings": [{"count": {"type": "literal", "value": "4"}}]}}
\ No newline at end of file
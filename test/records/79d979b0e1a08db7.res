@@ -0,0 +1,2 @@
+application/sparql-results+json
+{"head": {"vars": ["e1", "e2"]}, "results": {"bindings": [{"e1": {"type": "uri", "value": "http://pgxo.loria.fr/TPMT"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/TPMT*1"}}]}}
\ No newline at end of file
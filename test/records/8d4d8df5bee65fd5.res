@@ -0,0 +1,2 @@
+application/sparql-results+json
+{"head": {"vars": ["e1", "e2"]}, "results": {"bindings": [{"e1": {"type": "uri", "value": "http://pgxo.loria.fr/causes"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isCausedBy"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/decreases"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isDecreasedBy"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/decreasesChanceOf"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/hasChanceDecreasedBy"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotCause"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isNotCausedBy"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotDecrease"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isNotDecreasedBy"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotDecreaseChanceOf"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/hasNotChanceDecreasedBy"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotIncrease"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isNotIncreasedBy"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotIncreaseChanceOf"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/hasNotChanceIncreasedBy"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotInfluence"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isNotInfluencedBy"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotMetabolize"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isNotMetabolizedBy"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotTransport"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isNotTransportedBy"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotTreat"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isNotTreatedBy"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/hasChanceIncreasedBy"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/increasesChanceOf"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/increases"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isIncreasedBy"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/influences"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isInfluencedBy"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isMetabolizedBy"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/metabolizes"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isTransportedBy"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/transports"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isTreatedBy"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/treats"}}, {"e1": {"type": "uri", "value": "http://purl.obolibrary.org/obo/BFO_0000050"}, "e2": {"type": "uri", "value": "http://purl.obolibrary.org/obo/BFO_0000051"}}]}}
\ No newline at end of file
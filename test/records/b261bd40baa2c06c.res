@@ -0,0 +1,2 @@
+application/sparql-results+json
+{"head": {"vars": ["e"]}, "results": {"bindings": [{"e": {"type": "uri", "value": "http://pgxo.loria.fr/isAssociatedWith"}}, {"e": {"type": "uri", "value": "http://pgxo.loria.fr/isNotAssociatedWith"}}]}}
\ No newline at end of file
@@ -0,0 +1,2 @@
+application/sparql-results+json
+{"head": {"vars": ["e1", "e2"]}, "results": {"bindings": [{"e1": {"type": "uri", "value": "http://pgxo.loria.fr/ADR1"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/drug1"}}]}}
\ No newline at end of file
@@ -0,0 +1,2 @@
+application/sparql-results+json
+{"head": {"vars": ["e1", "e2"]}, "results": {"bindings": [{"e1": {"type": "uri", "value": "http://pgxo.loria.fr/"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#Ontology"}}, {"e1": {"type": "uri", "value": "http://purl.org/dc/elements/1.1/creator"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#AnnotationProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/causes"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/decreases"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/decreasesChanceOf"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotCause"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotDecrease"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotDecreaseChanceOf"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotIncrease"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotIncreaseChanceOf"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotInfluence"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotMetabolize"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotTransport"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotTreat"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/hasChanceDecreasedBy"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/hasChanceIncreasedBy"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/hasNotChanceDecreasedBy"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/hasNotChanceIncreasedBy"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/increases"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/increasesChanceOf"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/influences"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isAssociatedWith"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isCausedBy"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isDecreasedBy"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isIncreasedBy"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isInfluencedBy"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isMetabolizedBy"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isNotAssociatedWith"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isNotCausedBy"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isNotDecreasedBy"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isNotIncreasedBy"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isNotInfluencedBy"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isNotMetabolizedBy"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isNotTransportedBy"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isNotTreatedBy"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isTransportedBy"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isTreatedBy"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/metabolizes"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/qualifiedProxy"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/qualifiedVariation"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/transports"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/treats"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://purl.obolibrary.org/obo/BFO_0000050"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://purl.obolibrary.org/obo/BFO_0000051"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://purl.obolibrary.org/obo/RO_0002502"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://www.ontologydesignpatterns.org/ont/dul/DUL.owl#hasQuality"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#ObjectProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isAssociatedWith"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#SymmetricProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isNotAssociatedWith"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#SymmetricProperty"}}, {"e1": {"type": "uri", "value": "http://www.ontologydesignpatterns.org/ont/dul/DUL.owl#hasDataValue"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#DatatypeProperty"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/Disease"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#Class"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/Drug"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#Class"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/Gene"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#Class"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/GeneticFactor"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#Class"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/GenomicVariation"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#Class"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/Haplotype"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#Class"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/PharmacodynamicPhenotype"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#Class"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/PharmacogenomicRelationship"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#Class"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/PharmacokineticPhenotype"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#Class"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/Phenotype"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#Class"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/Variant"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#Class"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/test/CardiovascularDiseases"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#Class"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/test/HeartBlock"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#Class"}}, {"e1": {"type": "uri", "value": "http://www.ontologydesignpatterns.org/ont/dul/DUL.owl#Entity"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#Class"}}, {"e1": {"type": "uri", "value": "http://www.ontologydesignpatterns.org/ont/dul/DUL.owl#Quality"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#Class"}}, {"e1": {"type": "uri", "value": "http://www.w3.org/ns/prov#Entity"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#Class"}}, {"e1": {"type": "uri", "value": "http://www.w3.org/ns/prov#Generation"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#Class"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/ADR1"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/ADR10"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/ADR2"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/ADR3"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/ADR4"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/ADR5"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/ADR6"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/ADR7"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/ADR8"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/ADR9"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/CYP2C9"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/TPMT"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/bleeding"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/cardiovascular_diseases_inst1"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/cardiovascular_diseases_inst2"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/cardiovascular_diseases_inst3"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/cardiovascular_diseases_inst4"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/cardiovascular_diseases_inst5"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/drug1"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/drug2"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/gene1"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/heart_block_inst1"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/heart_block_inst2"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/heart_block_inst3"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/heart_block_inst4"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/heart_block_inst5"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/iron_deficiency_anemia"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r1"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r10"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r11"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r12"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r14"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r15"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r16"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r17"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r18"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r19"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r2"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r20"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r21"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r3"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r4"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r5"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r6"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r7"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r8"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r9"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/thiopurine"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/warfarin"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/TPMT*1"}, "e2": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#NamedIndividual"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/ADR1"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Phenotype"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/ADR10"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Phenotype"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/ADR2"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Phenotype"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/ADR3"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Phenotype"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/ADR4"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Phenotype"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/ADR5"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Phenotype"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/ADR6"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Phenotype"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/ADR7"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Phenotype"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/ADR8"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Phenotype"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/ADR9"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Phenotype"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/bleeding"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Phenotype"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/cardiovascular_diseases_inst1"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Phenotype"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/cardiovascular_diseases_inst3"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Phenotype"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/cardiovascular_diseases_inst4"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Phenotype"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/cardiovascular_diseases_inst5"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Phenotype"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/heart_block_inst1"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Phenotype"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/heart_block_inst2"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Phenotype"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/heart_block_inst3"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Phenotype"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/heart_block_inst4"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Phenotype"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/heart_block_inst5"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Phenotype"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/iron_deficiency_anemia"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Phenotype"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/CYP2C9"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Gene"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/TPMT"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Gene"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/gene1"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Gene"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/cardiovascular_diseases_inst2"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Disease"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/cardiovascular_diseases_inst4"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/test/CardiovascularDiseases"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/drug1"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Drug"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/drug2"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Drug"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/thiopurine"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Drug"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/warfarin"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Drug"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/heart_block_inst2"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/test/HeartBlock"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/heart_block_inst5"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/test/HeartBlock"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r1"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/PharmacogenomicRelationship"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r10"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/PharmacogenomicRelationship"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r11"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/PharmacogenomicRelationship"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r12"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/PharmacogenomicRelationship"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r14"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/PharmacogenomicRelationship"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r15"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/PharmacogenomicRelationship"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r16"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/PharmacogenomicRelationship"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r17"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/PharmacogenomicRelationship"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r18"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/PharmacogenomicRelationship"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r19"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/PharmacogenomicRelationship"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r2"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/PharmacogenomicRelationship"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r20"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/PharmacogenomicRelationship"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r21"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/PharmacogenomicRelationship"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r3"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/PharmacogenomicRelationship"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r4"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/PharmacogenomicRelationship"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r5"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/PharmacogenomicRelationship"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r6"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/PharmacogenomicRelationship"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r7"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/PharmacogenomicRelationship"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r8"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/PharmacogenomicRelationship"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/r9"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/PharmacogenomicRelationship"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/TPMT*1"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Haplotype"}}]}}
\ No newline at end of file
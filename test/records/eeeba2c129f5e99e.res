@@ -0,0 +1,2 @@
+application/sparql-results+json
+{"head": {"vars": ["e"]}, "results": {"bindings": [{"e": {"type": "uri", "value": "http://www.w3.org/1999/02/22-rdf-syntax-ns#type"}}, {"e": {"type": "uri", "value": "http://pgxo.loria.fr/isNotAssociatedWith"}}, {"e": {"type": "uri", "value": "http://purl.org/dc/elements/1.1/creator"}}, {"e": {"type": "uri", "value": "http://pgxo.loria.fr/causes"}}, {"e": {"type": "uri", "value": "http://pgxo.loria.fr/isCausedBy"}}, {"e": {"type": "uri", "value": "http://pgxo.loria.fr/isAssociatedWith"}}, {"e": {"type": "uri", "value": "http://www.w3.org/2000/01/rdf-schema#label"}}, {"e": {"type": "uri", "value": "http://www.w3.org/2000/01/rdf-schema#subClassOf"}}, {"e": {"type": "uri", "value": "http://www.w3.org/2000/01/rdf-schema#subPropertyOf"}}, {"e": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#inverseOf"}}, {"e": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#sameAs"}}, {"e": {"type": "uri", "value": "http://purl.obolibrary.org/obo/BFO_0000050"}}, {"e": {"type": "uri", "value": "http://www.w3.org/2000/01/rdf-schema#domain"}}, {"e": {"type": "uri", "value": "http://www.w3.org/2000/01/rdf-schema#comment"}}, {"e": {"type": "uri", "value": "http://www.w3.org/2000/01/rdf-schema#range"}}, {"e": {"type": "uri", "value": "http://www.w3.org/2002/07/owl#versionInfo"}}, {"e": {"type": "uri", "value": "http://purl.obolibrary.org/obo/RO_0002502"}}, {"e": {"type": "uri", "value": "http://pgxo.loria.fr/influences"}}, {"e": {"type": "uri", "value": "http://pgxo.loria.fr/isInfluencedBy"}}, {"e": {"type": "uri", "value": "http://purl.obolibrary.org/obo/BFO_0000051"}}]}}
\ No newline at end of file
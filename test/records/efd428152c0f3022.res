@@ -0,0 +1,2 @@
+application/sparql-results+json
+{"head": {"vars": ["e1", "e2"]}, "results": {"bindings": [{"e1": {"type": "uri", "value": "http://pgxo.loria.fr/causes"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/influences"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/decreases"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/influences"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/decreasesChanceOf"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/influences"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/increases"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/influences"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/increasesChanceOf"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/influences"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/metabolizes"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/influences"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/transports"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/influences"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotCause"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotInfluence"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotDecrease"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotInfluence"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotDecreaseChanceOf"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotInfluence"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotIncrease"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotInfluence"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotIncreaseChanceOf"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotInfluence"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotMetabolize"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotInfluence"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotTransport"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotInfluence"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotInfluence"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isNotAssociatedWith"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/doesNotTreat"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isNotAssociatedWith"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isNotInfluencedBy"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isNotAssociatedWith"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isNotTreatedBy"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isNotAssociatedWith"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/hasChanceDecreasedBy"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isInfluencedBy"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/hasChanceIncreasedBy"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isInfluencedBy"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isCausedBy"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isInfluencedBy"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isDecreasedBy"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isInfluencedBy"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isIncreasedBy"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isInfluencedBy"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isMetabolizedBy"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isInfluencedBy"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isTransportedBy"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isInfluencedBy"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/hasNotChanceDecreasedBy"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isNotInfluencedBy"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/hasNotChanceIncreasedBy"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isNotInfluencedBy"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isNotCausedBy"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isNotInfluencedBy"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isNotDecreasedBy"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isNotInfluencedBy"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isNotIncreasedBy"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isNotInfluencedBy"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isNotMetabolizedBy"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isNotInfluencedBy"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isNotTransportedBy"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isNotInfluencedBy"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/influences"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isAssociatedWith"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isInfluencedBy"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isAssociatedWith"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/isTreatedBy"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isAssociatedWith"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/treats"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/isAssociatedWith"}}]}}
\ No newline at end of file
@@ -0,0 +1,2 @@
+application/sparql-results+json
+{"head": {"vars": ["e1", "e2"]}, "results": {"bindings": [{"e1": {"type": "uri", "value": "http://pgxo.loria.fr/Disease"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Phenotype"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/PharmacodynamicPhenotype"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Phenotype"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/PharmacokineticPhenotype"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/Phenotype"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/Gene"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/GeneticFactor"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/GenomicVariation"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/GeneticFactor"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/Haplotype"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/GenomicVariation"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/Variant"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/GenomicVariation"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/PharmacogenomicRelationship"}, "e2": {"type": "uri", "value": "http://www.w3.org/ns/prov#Entity"}}, {"e1": {"type": "uri", "value": "http://pgxo.loria.fr/test/HeartBlock"}, "e2": {"type": "uri", "value": "http://pgxo.loria.fr/test/CardiovascularDiseases"}}, {"e1": {"type": "uri", "value": "http://www.ontologydesignpatterns.org/ont/dul/DUL.owl#Quality"}, "e2": {"type": "uri", "value": "http://www.ontologydesignpatterns.org/ont/dul/DUL.owl#Entity"}}, {"e1": {"type": "uri", "value": "http://www.w3.org/ns/prov#Generation"}, "e2": {"type": "uri", "value": "http://www.ontologydesignpatterns.org/ont/dul/DUL.owl#Entity"}}]}}
\ No newline at end of file
@@ -0,0 +1,35 @@
+#!/bin/bash
+# Regression test without a triplestore: the queries of test/test-conf.json, recorded in test/records, are replayed by
+# tcn3r-replay and the (sorted) output of tcn3r is compared with test/expected-output.ttl
+# Usage: test/replay-test.sh BUILD_DIRECTORY (directory containing tcn3r and tcn3r-replay), REPLAY_PORT may be set to
+# use another port than 8891
+
+TEST_DIR="$(cd "$(dirname "$0")" && pwd)"
+BIN_DIR="$(cd "${1:?Usage: $0 BUILD_DIRECTORY}" && pwd)"
+PORT="${REPLAY_PORT:-8891}"
+WORK_DIR="$(mktemp -d)"
+
+"$BIN_DIR/tcn3r-replay" --directory "$TEST_DIR/records" --port "$PORT" > "$WORK_DIR/replay.log" 2>&1 &
+REPLAY_PID=$!
+trap 'kill $REPLAY_PID 2> /dev/null; rm -rf "$WORK_DIR"' EXIT
+
+for i in $(seq 1 50); do
+    (echo > "/dev/tcp/127.0.0.1/$PORT") 2> /dev/null && break
+    sleep 0.1
+done
+
+sed "s#http://127.0.0.1:8890/sparql#http://127.0.0.1:$PORT/sparql#" "$TEST_DIR/test-conf.json" > "$WORK_DIR/conf.json"
+
+if ! "$BIN_DIR/tcn3r" --configuration "$WORK_DIR/conf.json" -o "$WORK_DIR/output.ttl" --simlimit 0.85 --complimit 3 \
+        --dimensionlimit 3 > "$WORK_DIR/tcn3r.log" 2>&1; then
+    cat "$WORK_DIR/tcn3r.log" "$WORK_DIR/replay.log"
+    echo "FAILED: tcn3r did not complete"
+    exit 1
+fi
+
+if ! sort "$WORK_DIR/output.ttl" | diff - <(sort "$TEST_DIR/expected-output.ttl"); then
+    echo "FAILED: output differs from test/expected-output.ttl"
+    exit 1
+fi
+
+echo "PASSED"